@@ -0,0 +1,109 @@
+#include "biquad_designer.h"
+#include <Arduino.h>
+#include <math.h>
+
+BiquadType biquad_parseType(const char* name) {
+  static const struct { const char* name; BiquadType type; } types[] = {
+    {"peaking", BIQUAD_PEAKING},   {"lowshelf", BIQUAD_LOWSHELF},
+    {"highshelf", BIQUAD_HIGHSHELF}, {"lowpass", BIQUAD_LOWPASS},
+    {"highpass", BIQUAD_HIGHPASS}, {"bandpass", BIQUAD_BANDPASS},
+    {"notch", BIQUAD_NOTCH},       {"allpass", BIQUAD_ALLPASS}
+  };
+
+  if (!name) return BIQUAD_INVALID;
+  for (const auto& t : types) {
+    if (strcasecmp(name, t.name) == 0) return t.type;
+  }
+  return BIQUAD_INVALID;
+}
+
+// One band: normalized coefficients b0, b1, b2, a1, a2 (a0 = 1)
+static bool biquadDesign(const BiquadSpec& s, float fs, float c[BIQUAD_PARAM_WORDS]) {
+  if (s.type == BIQUAD_INVALID || !(s.f0 > 0.0f) || s.f0 >= fs * 0.5f || !(s.q > 0.0f)) {
+    return false;
+  }
+
+  const float w0 = 2.0f * (float)M_PI * s.f0 / fs;
+  const float cw = cosf(w0);
+  const float alpha = sinf(w0) / (2.0f * s.q);
+  const float A = powf(10.0f, s.gainDb / 40.0f);
+
+  float b0, b1, b2, a0, a1, a2;
+  switch (s.type) {
+    case BIQUAD_PEAKING:
+      b0 = 1.0f + alpha * A;  b1 = -2.0f * cw;  b2 = 1.0f - alpha * A;
+      a0 = 1.0f + alpha / A;  a1 = -2.0f * cw;  a2 = 1.0f - alpha / A;
+      break;
+    case BIQUAD_LOWSHELF: {
+      const float k = 2.0f * sqrtf(A) * alpha;
+      b0 = A * ((A + 1.0f) - (A - 1.0f) * cw + k);
+      b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cw);
+      b2 = A * ((A + 1.0f) - (A - 1.0f) * cw - k);
+      a0 = (A + 1.0f) + (A - 1.0f) * cw + k;
+      a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cw);
+      a2 = (A + 1.0f) + (A - 1.0f) * cw - k;
+      break;
+    }
+    case BIQUAD_HIGHSHELF: {
+      const float k = 2.0f * sqrtf(A) * alpha;
+      b0 = A * ((A + 1.0f) + (A - 1.0f) * cw + k);
+      b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cw);
+      b2 = A * ((A + 1.0f) + (A - 1.0f) * cw - k);
+      a0 = (A + 1.0f) - (A - 1.0f) * cw + k;
+      a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cw);
+      a2 = (A + 1.0f) - (A - 1.0f) * cw - k;
+      break;
+    }
+    case BIQUAD_LOWPASS:
+      b1 = 1.0f - cw;  b0 = b1 * 0.5f;  b2 = b0;
+      a0 = 1.0f + alpha;  a1 = -2.0f * cw;  a2 = 1.0f - alpha;
+      break;
+    case BIQUAD_HIGHPASS:
+      b1 = -(1.0f + cw);  b0 = -b1 * 0.5f;  b2 = b0;
+      a0 = 1.0f + alpha;  a1 = -2.0f * cw;  a2 = 1.0f - alpha;
+      break;
+    case BIQUAD_BANDPASS:  // Constant 0 dB peak gain
+      b0 = alpha;  b1 = 0.0f;  b2 = -alpha;
+      a0 = 1.0f + alpha;  a1 = -2.0f * cw;  a2 = 1.0f - alpha;
+      break;
+    case BIQUAD_NOTCH:
+      b0 = 1.0f;  b1 = -2.0f * cw;  b2 = 1.0f;
+      a0 = 1.0f + alpha;  a1 = -2.0f * cw;  a2 = 1.0f - alpha;
+      break;
+    case BIQUAD_ALLPASS:
+      b0 = 1.0f - alpha;  b1 = -2.0f * cw;  b2 = 1.0f + alpha;
+      a0 = 1.0f + alpha;  a1 = -2.0f * cw;  a2 = 1.0f - alpha;
+      break;
+    default:
+      return false;
+  }
+
+  const float inv = 1.0f / a0;
+  c[0] = b0 * inv;
+  c[1] = b1 * inv;
+  c[2] = b2 * inv;
+  c[3] = -a1 * inv;  // SigmaStudio adds the feedback terms
+  c[4] = -a2 * inv;
+  return true;
+}
+
+bool biquad_designBands(const BiquadSpec* specs, size_t count, float sampleRate,
+                        DSPParamWrite* out, size_t* badBand) {
+  float c[BIQUAD_PARAM_WORDS];
+
+  for (size_t band = 0; band < count; band++) {
+    const BiquadSpec& s = specs[band];
+    if (s.paramAddr + BIQUAD_PARAM_WORDS > ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS ||
+        !biquadDesign(s, sampleRate, c)) {
+      if (badBand) *badBand = band;
+      return false;
+    }
+
+    DSPParamWrite* w = &out[band * BIQUAD_PARAM_WORDS];
+    for (int i = 0; i < BIQUAD_PARAM_WORDS; i++) {
+      w[i].address = s.paramAddr + i;
+      w[i].value = dsp_floatTo523(c[i]);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,42 @@
+#ifndef BIQUAD_DESIGNER_H
+#define BIQUAD_DESIGNER_H
+
+#include <Arduino.h>
+#include "dsp_helper.h"
+
+// Words per SigmaStudio biquad block: B0, B1, B2, A1, A2
+#define BIQUAD_PARAM_WORDS 5
+// Bands accepted per design request
+#define BIQUAD_MAX_BANDS 16
+
+enum BiquadType {
+  BIQUAD_INVALID = 0,
+  BIQUAD_PEAKING,
+  BIQUAD_LOWSHELF,
+  BIQUAD_HIGHSHELF,
+  BIQUAD_LOWPASS,
+  BIQUAD_HIGHPASS,
+  BIQUAD_BANDPASS,
+  BIQUAD_NOTCH,
+  BIQUAD_ALLPASS
+};
+
+struct BiquadSpec {
+  BiquadType type;
+  float f0;               // Centre/corner frequency, Hz
+  float q;
+  float gainDb;           // Peaking and shelf types only
+  uint16_t paramAddr;     // First parameter word of the biquad block
+};
+
+// "peaking", "lowshelf", "lowpass", ... (case-insensitive)
+BiquadType biquad_parseType(const char* name);
+
+// Design bands (RBJ cookbook) and emit SigmaStudio-ordered 5.23 words:
+// B0, B1, B2, A1, A2 with A1/A2 negated (SigmaStudio sign convention).
+// out must hold count * BIQUAD_PARAM_WORDS entries. Returns false and the
+// index of the first bad band in badBand if a spec is out of range.
+bool biquad_designBands(const BiquadSpec* specs, size_t count, float sampleRate,
+                        DSPParamWrite* out, size_t* badBand);
+
+#endif // BIQUAD_DESIGNER_H
@@ -5,15 +5,45 @@
 #define EEPROM_I2C_ADDRESS 0x50
 #define EEPROM_SIZE 32768        // 32KB EEPROM
 #define EEPROM_PAGE_SIZE 64      // Page size for writes
+#define EEPROM_WRITE_CYCLE_MS 5  // Internal write cycle (tWC) per page write
+#define EEPROM_ACK_POLL_US 100   // ACK poll period while a page write completes
 
 // I2C Pin Configuration for ESP32
 #define SDA_PIN 7               // GPIO21 (SDA on most ESP32 boards)
 #define SCL_PIN 9               // GPIO22 (SCL on most ESP32 boards)
+#define I2C_CLOCK_HZ 100000     // Bus clock (standard mode)
+#define I2C_FAST_CLOCK_HZ 400000 // Fast mode for bulk DSP transfers (snapshots)
+
+// Second I2C controller as a master bus (-1 = not wired; Wire1 is then free
+// for the EEPROM emulator). Device routing: 0 = SDA_PIN/SCL_PIN, 1 = I2C1 pins.
+#define I2C1_SDA_PIN -1
+#define I2C1_SCL_PIN -1
+#define I2C1_CLOCK_HZ 400000     // EEPROM-only bus can run fast mode throughout
+#define DSP_I2C_BUS 0
+#define EEPROM_I2C_BUS 0
+#define I2C_WORKER_STACK 4096
 
 // Write-Protect Pin Configuration
 #define EEPROM_WP_PIN 5          // GPIO4 (Adjust as needed for your ESP32 wiring)
 #define EEPROM_WP_ACTIVE_HIGH 1  // Set to 1 if WP is active HIGH
 
+// EEPROM Emulator (second I2C controller as a 24LC256 slave on the DSP boot bus)
+#define EMU_SDA_PIN 33           // Wire1 SDA to the ADAU1701 boot EEPROM bus
+#define EMU_SCL_PIN 35           // Wire1 SCL to the ADAU1701 boot EEPROM bus
+#define EMU_TX_BUFFER_SIZE 2048  // Minimum slave TX queue; grows to cover the staged image
+
+// Gang programming sockets (24LC256 at 0x50-0x57, optionally behind a TCA9548A)
+#define GANG_MUX_I2C_ADDRESS 0x70 // TCA9548A with A0-A2 low
+
+// DSP Reset Pin Configuration
+#define DSP_RESET_PIN -1         // GPIO driving ADAU1701 /RESET (active low), -1 if not wired
+#define DSP_RESET_PULSE_US 1000  // /RESET low time for a hard reset
+// GPIOs the web API may select as /RESET: ESP32-S2 outputs that are not
+// strapping (0, 45, 46), USB (19, 20), flash/PSRAM (26-32) or UART0 (43, 44)
+// pins. Pins in use by the I2C buses or write protect are refused as well.
+#define DSP_RESET_PIN_CHOICES { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 21, \
+                                33, 34, 35, 36, 37, 38, 39, 40, 41, 42 }
+
 // Debug and Logging
 #define EEPROM_DEBUG 0           // Set to 1 for verbose logging, 0 for production
 
@@ -31,6 +61,7 @@ constexpr uint8_t EEPROM_MAX_VERIFICATION_ERRORS_LOG = 3;      // Only log first
 #define DSP_I2C_ADDRESS 0x34     // 8-bit write address for 7-bit 0x34
 #define DSP_CONTROL_REGISTER 0xF000
 #define DSP_RUN_BIT_MASK 0x01
+#define DSP_SAMPLE_RATE 48000    // Default fs for on-device filter design
 
 // Memory Limits for ESP32 (increased due to more available RAM)
 #define MAX_HEAP_REQUIRED 4096  // Reserve 4KB for system stability
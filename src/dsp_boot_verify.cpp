@@ -0,0 +1,111 @@
+#include "dsp_boot_verify.h"
+#include "dsp_helper.h"
+#include "eeprom_manager.h"
+#include "selfboot_image.h"
+#include "config.h"
+#include "i2c_bus.h"
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME        16777619u
+
+static DSPBootVerifyRegion verifyRegions[DSP_BOOT_VERIFY_MAX_REGIONS];
+static uint8_t verifyRegionCount = 0;
+
+static uint32_t fnv1a(uint32_t hash, const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ data[i]) * FNV_PRIME;
+  }
+  return hash;
+}
+
+// Hash one region from the EEPROM and from the DSP, chunk by chunk
+static bool verifyRegion(const SelfBootRegion& src, DSPBootVerifyRegion& r) {
+  uint8_t image[DSP_BURST_MAX_DATA];
+  uint8_t dsp[DSP_BURST_MAX_DATA];
+  size_t wordBytes = dsp_memoryWordBytes(src.subaddress);
+
+  r.imageHash = FNV_OFFSET_BASIS;
+  r.dspHash = FNV_OFFSET_BASIS;
+  for (uint16_t offset = 0; offset < src.length;) {
+    // Chunk is a whole number of words for both memories
+    size_t n = min((size_t)(src.length - offset), (DSP_BURST_MAX_DATA / wordBytes) * wordBytes);
+    if (!readBlockFromEEPROM(src.dataOffset + offset, image, n) ||
+        !dsp_readBlock(src.subaddress + offset / wordBytes, dsp, n)) {
+      return false;
+    }
+    r.imageHash = fnv1a(r.imageHash, image, n);
+    r.dspHash = fnv1a(r.dspHash, dsp, n);
+    if (r.firstMismatch < 0 && memcmp(image, dsp, n) != 0) {
+      for (size_t i = 0; i < n; i++) {
+        if (image[i] != dsp[i]) {
+          r.firstMismatch = offset + i;
+          break;
+        }
+      }
+    }
+    offset += n;
+  }
+  r.match = (r.imageHash == r.dspHash);
+  return true;
+}
+
+DSPBootVerifyResult dsp_boot_verify_run() {
+  DSPBootVerifyResult result = {};
+  unsigned long startTime = millis();
+
+  SelfBootRegion sources[DSP_BOOT_VERIFY_MAX_REGIONS];
+  selfboot_setRegionLog(sources, DSP_BOOT_VERIFY_MAX_REGIONS);
+  SelfBootImageInfo info = selfboot_analyzeEEPROM();
+  selfboot_setRegionLog(nullptr, 0);
+
+  result.imageValid = info.valid;
+  verifyRegionCount = 0;
+  if (!info.valid) {
+    result.error = info.error ? info.error : "No valid self-boot image";
+    result.durationMs = millis() - startTime;
+    return result;
+  }
+
+  verifyRegionCount = min(selfboot_getRegionCount(), (uint16_t)DSP_BOOT_VERIFY_MAX_REGIONS);
+  result.regions = verifyRegionCount;
+
+  uint8_t bus = dsp_busLock();
+  i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+  for (uint8_t i = 0; i < verifyRegionCount; i++) {
+    DSPBootVerifyRegion& r = verifyRegions[i];
+    memset(&r, 0, sizeof(r));
+    r.subaddress = sources[i].subaddress;
+    r.length = sources[i].length;
+    r.firstMismatch = -1;
+
+    // Control registers change once the core runs - only RAM is compared
+    if (r.length == 0 || dsp_memoryWordBytes(r.subaddress) == 0) {
+      continue;
+    }
+    if (!verifyRegion(sources[i], r)) {
+      result.error = "Read failed";
+      break;
+    }
+    r.checked = true;
+    result.checked++;
+    result.bytesCompared += r.length;
+    if (!r.match) {
+      result.mismatches++;
+    }
+    yield();
+  }
+  i2c_setClock(bus, 0);
+  dsp_busUnlock(bus);
+
+  result.ok = (result.error == nullptr && result.mismatches == 0);
+  result.durationMs = millis() - startTime;
+  Serial.printf("DSP boot verify: %u/%u regions match, %lu bytes in %lu ms\n",
+                result.checked - result.mismatches, result.checked,
+                (unsigned long)result.bytesCompared, (unsigned long)result.durationMs);
+  return result;
+}
+
+const DSPBootVerifyRegion* dsp_boot_verify_getRegions(uint8_t& count) {
+  count = verifyRegionCount;
+  return verifyRegions;
+}
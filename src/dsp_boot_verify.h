@@ -0,0 +1,35 @@
+#ifndef DSP_BOOT_VERIFY_H
+#define DSP_BOOT_VERIFY_H
+
+#include <Arduino.h>
+
+// Post-boot check that the DSP RAM holds what the EEPROM self-boot image
+// wrote: each parameter/program RAM write message is hashed on both sides.
+#define DSP_BOOT_VERIFY_MAX_REGIONS 16
+
+struct DSPBootVerifyRegion {
+  uint16_t subaddress;
+  uint16_t length;          // Data bytes
+  uint32_t imageHash;       // FNV-1a of the image data
+  uint32_t dspHash;         // FNV-1a of the DSP RAM read back
+  int32_t firstMismatch;    // Byte offset of the first difference, -1 if none
+  bool checked;             // false for control registers (not read back)
+  bool match;
+};
+
+struct DSPBootVerifyResult {
+  bool imageValid;
+  bool ok;                  // Every checked region matched
+  uint8_t regions;          // Regions logged (capped at the max)
+  uint8_t checked;
+  uint8_t mismatches;
+  uint32_t bytesCompared;
+  uint32_t durationMs;
+  const char* error;        // nullptr if the run completed
+};
+
+// Walk the EEPROM image and compare every RAM region against the DSP
+DSPBootVerifyResult dsp_boot_verify_run();
+const DSPBootVerifyRegion* dsp_boot_verify_getRegions(uint8_t& count);
+
+#endif // DSP_BOOT_VERIFY_H
@@ -1,6 +1,6 @@
 #include "dsp_helper.h"
 #include "config.h"
-#include <Wire.h>
+#include "i2c_bus.h"
 
 // External dependency for EEPROM write protect (used in self-boot)
 extern void setWriteProtect(bool enable);
@@ -9,6 +9,7 @@ extern void setWriteProtect(bool enable);
 static bool g_dsp_initialized = false;
 static uint8_t g_dsp_address = DSP_I2C_ADDRESS;
 static int g_last_error = 0;
+static int8_t g_dsp_reset_pin = DSP_RESET_PIN;
 
 // Error codes
 #define DSP_ERR_NONE              0
@@ -25,6 +26,8 @@ static void dsp_setLastError(int error);
 
 // Initialize DSP communication
 bool dsp_init() {
+    dsp_setResetPin(g_dsp_reset_pin);  // Hold /RESET released
+
     if (g_dsp_initialized) {
         return true;
     }
@@ -42,10 +45,13 @@ bool dsp_init() {
 
 // Detect DSP device on I2C bus
 bool dsp_detect() {
-    Wire.beginTransmission(g_dsp_address);
-    int result = Wire.endTransmission();
+    uint8_t bus = dsp_busLock();
+    TwoWire& wire = i2c_wire(bus);
+    wire.beginTransmission(g_dsp_address);
+    int result = wire.endTransmission();
 
     if (result == 0) {
+        dsp_busUnlock(bus);
         Serial.printf("DSP: Detected at address 0x%02X\n", g_dsp_address);
         return true;
     }
@@ -56,9 +62,10 @@ bool dsp_detect() {
     for (uint8_t alt_addr : alt_addresses) {
         if (alt_addr == g_dsp_address) continue;
 
-        Wire.beginTransmission(alt_addr);
-        result = Wire.endTransmission();
+        wire.beginTransmission(alt_addr);
+        result = wire.endTransmission();
         if (result == 0) {
+            dsp_busUnlock(bus);
             Serial.printf("DSP: Detected at alternative address 0x%02X (configured: 0x%02X)\n",
                          alt_addr, g_dsp_address);
             g_dsp_address = alt_addr; // Update to working address
@@ -66,57 +73,65 @@ bool dsp_detect() {
         }
     }
 
+    dsp_busUnlock(bus);
     dsp_setLastError(DSP_ERR_NOT_DETECTED);
     return false;
 }
 
 // Internal register write (no verification)
 static bool dsp_writeRegisterInternal(uint16_t regAddr, uint8_t value) {
-    Wire.beginTransmission(g_dsp_address);
+    uint8_t bus = dsp_busLock();
+    TwoWire& wire = i2c_wire(bus);
+    wire.beginTransmission(g_dsp_address);
 
     // ADAU1701 uses 16-bit register addresses, sent as two bytes
-    Wire.write((uint8_t)(regAddr >> 8));    // High byte
-    Wire.write((uint8_t)(regAddr & 0xFF));  // Low byte
-    Wire.write(value);                      // Data byte
+    wire.write((uint8_t)(regAddr >> 8));    // High byte
+    wire.write((uint8_t)(regAddr & 0xFF));  // Low byte
+    wire.write(value);                      // Data byte
 
-    int result = Wire.endTransmission();
+    int result = wire.endTransmission();
+    dsp_busUnlock(bus);
 
     if (result != 0) {
         dsp_setLastError(result == 5 ? DSP_ERR_I2C_TIMEOUT : DSP_ERR_I2C_NACK);
         return false;
     }
 
-    delayMicroseconds(DSP_COMM_DELAY_US); // Allow DSP to process
     return true;
 }
 
 // Internal register read
 static bool dsp_readRegisterInternal(uint16_t regAddr, uint8_t& value) {
+    uint8_t bus = dsp_busLock();
+    TwoWire& wire = i2c_wire(bus);
+
     // Write register address
-    Wire.beginTransmission(g_dsp_address);
-    Wire.write((uint8_t)(regAddr >> 8));    // High byte
-    Wire.write((uint8_t)(regAddr & 0xFF));  // Low byte
-    int writeResult = Wire.endTransmission(false); // Restart condition
+    wire.beginTransmission(g_dsp_address);
+    wire.write((uint8_t)(regAddr >> 8));    // High byte
+    wire.write((uint8_t)(regAddr & 0xFF));  // Low byte
+    int writeResult = wire.endTransmission(false); // Restart condition
 
     if (writeResult != 0) {
+        dsp_busUnlock(bus);
         dsp_setLastError(DSP_ERR_I2C_NACK);
         return false;
     }
 
     // Read data
-    Wire.requestFrom(g_dsp_address, (uint8_t)1);
+    wire.requestFrom(g_dsp_address, (uint8_t)1);
     unsigned long startTime = millis();
 
-    while (!Wire.available()) {
+    while (!wire.available()) {
         if (millis() - startTime > DSP_I2C_TIMEOUT_MS) {
+            dsp_busUnlock(bus);
             dsp_setLastError(DSP_ERR_I2C_TIMEOUT);
             return false;
         }
         delay(1);
     }
 
-    value = Wire.read();
-    delayMicroseconds(DSP_COMM_DELAY_US);
+    value = wire.read();
+    dsp_busUnlock(bus);
     return true;
 }
 
@@ -150,16 +165,240 @@ bool dsp_writeRegisterVerified(uint16_t regAddr, uint8_t value) {
     return false;
 }
 
-// Read multiple consecutive registers
+// Read multiple consecutive registers (single burst)
 bool dsp_readMultipleRegisters(uint16_t startAddr, uint8_t* buffer, size_t count) {
-    for (size_t i = 0; i < count; i++) {
-        if (!dsp_readRegisterInternal(startAddr + i, buffer[i])) {
+    return dsp_readBlock(startAddr, buffer, count);
+}
+
+// Parameter RAM shadow: last value written per word, valid bit per word.
+// Lets preset recall skip words the DSP already holds.
+static int32_t g_param_shadow[ADAU1701_PARAM_RAM_WORDS];
+static uint8_t g_param_shadow_valid[ADAU1701_PARAM_RAM_WORDS / 8];
+
+static void dsp_shadowStore(uint16_t paramAddr, const uint8_t* word) {
+    if (paramAddr >= ADAU1701_PARAM_RAM_WORDS) return;
+    g_param_shadow[paramAddr] = (int32_t)(((uint32_t)word[0] << 24) | ((uint32_t)word[1] << 16) |
+                                          ((uint32_t)word[2] << 8) | word[3]);
+    g_param_shadow_valid[paramAddr >> 3] |= (1 << (paramAddr & 7));
+}
+
+bool dsp_shadowGet(uint16_t paramAddr, int32_t& value) {
+    if (paramAddr >= ADAU1701_PARAM_RAM_WORDS ||
+        !(g_param_shadow_valid[paramAddr >> 3] & (1 << (paramAddr & 7)))) {
+        return false;
+    }
+    value = g_param_shadow[paramAddr];
+    return true;
+}
+
+void dsp_shadowInvalidate() {
+    memset(g_param_shadow_valid, 0, sizeof(g_param_shadow_valid));
+}
+
+uint16_t dsp_shadowValidCount() {
+    uint16_t count = 0;
+    for (size_t i = 0; i < sizeof(g_param_shadow_valid); i++) {
+        count += __builtin_popcount(g_param_shadow_valid[i]);
+    }
+    return count;
+}
+
+// Fill the shadow from the DSP (e.g. after self-boot loaded parameters)
+bool dsp_shadowSync() {
+    uint8_t buf[DSP_BURST_MAX_DATA];
+    for (uint16_t addr = 0; addr < ADAU1701_PARAM_RAM_WORDS; addr += sizeof(buf) / ADAU1701_PARAM_WORD_BYTES) {
+        if (!dsp_readBlock(ADAU1701_PARAM_RAM_START + addr, buf, sizeof(buf))) {
             return false;
         }
+        for (size_t i = 0; i < sizeof(buf) / ADAU1701_PARAM_WORD_BYTES; i++) {
+            dsp_shadowStore(addr + i, &buf[i * ADAU1701_PARAM_WORD_BYTES]);
+        }
+        yield();
     }
     return true;
 }
 
+// Bytes per auto-increment step at a subaddress (0 for control registers,
+// whose widths vary and which are transferred as a single transaction)
+size_t dsp_memoryWordBytes(uint16_t subaddress) {
+    if (subaddress < ADAU1701_PROG_RAM_START) return ADAU1701_PARAM_WORD_BYTES;
+    if (subaddress < ADAU1701_HW_REG_START) return ADAU1701_PROG_WORD_BYTES;
+    return 0;
+}
+
+// Largest word-aligned burst for a subaddress, 0 if the length is invalid
+static size_t dsp_burstChunkBytes(uint16_t subaddress, size_t length) {
+    size_t wordBytes = dsp_memoryWordBytes(subaddress);
+    if (length == 0 || (wordBytes && length % wordBytes != 0) ||
+        (!wordBytes && length > DSP_BURST_MAX_DATA)) {
+        return 0;
+    }
+    return wordBytes ? (DSP_BURST_MAX_DATA / wordBytes) * wordBytes : DSP_BURST_MAX_DATA;
+}
+
+// Burst write: one addressed transaction per DSP_BURST_MAX_DATA bytes, split
+// on word boundaries so the subaddress advances by whole words per burst.
+// No per-byte settling delay - the DSP accepts back-to-back bursts.
+static bool dsp_writeBlockTo(uint8_t devAddr, uint16_t subaddress, const uint8_t* data, size_t length) {
+    size_t wordBytes = dsp_memoryWordBytes(subaddress);
+    size_t maxChunk = dsp_burstChunkBytes(subaddress, length);
+    if (maxChunk == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    size_t done = 0;
+    while (done < length) {
+        size_t n = min(maxChunk, length - done);
+
+        uint8_t bus = dsp_busLock();
+        TwoWire& wire = i2c_wire(bus);
+        wire.beginTransmission(devAddr);
+        wire.write((uint8_t)(subaddress >> 8));
+        wire.write((uint8_t)(subaddress & 0xFF));
+        wire.write(data + done, n);
+        int result = wire.endTransmission();
+        dsp_busUnlock(bus);
+
+        if (result != 0) {
+            dsp_setLastError(result == 5 ? DSP_ERR_I2C_TIMEOUT : DSP_ERR_I2C_NACK);
+            return false;
+        }
+
+        if (devAddr == g_dsp_address && subaddress < ADAU1701_PROG_RAM_START) {
+            for (size_t i = 0; i < n; i += ADAU1701_PARAM_WORD_BYTES) {
+                dsp_shadowStore(subaddress + i / ADAU1701_PARAM_WORD_BYTES, data + done + i);
+            }
+        }
+
+        done += n;
+        if (wordBytes) {
+            subaddress += n / wordBytes;
+        }
+    }
+    return true;
+}
+
+// Burst read: subaddress write, repeated start, then up to
+// DSP_BURST_MAX_DATA bytes per transaction with auto-increment.
+static bool dsp_readBlockFrom(uint8_t devAddr, uint16_t subaddress, uint8_t* buffer, size_t length) {
+    size_t wordBytes = dsp_memoryWordBytes(subaddress);
+    size_t maxChunk = dsp_burstChunkBytes(subaddress, length);
+    if (maxChunk == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    size_t done = 0;
+    while (done < length) {
+        size_t n = min(maxChunk, length - done);
+
+        uint8_t bus = dsp_busLock();
+        TwoWire& wire = i2c_wire(bus);
+        wire.beginTransmission(devAddr);
+        wire.write((uint8_t)(subaddress >> 8));
+        wire.write((uint8_t)(subaddress & 0xFF));
+        if (wire.endTransmission(false) != 0) { // Restart condition
+            dsp_busUnlock(bus);
+            dsp_setLastError(DSP_ERR_I2C_NACK);
+            return false;
+        }
+
+        if (wire.requestFrom(devAddr, (uint8_t)n) != n) {
+            dsp_busUnlock(bus);
+            dsp_setLastError(DSP_ERR_I2C_TIMEOUT);
+            return false;
+        }
+        for (size_t i = 0; i < n; i++) {
+            buffer[done + i] = wire.read();
+        }
+        dsp_busUnlock(bus);
+
+        done += n;
+        if (wordBytes) {
+            subaddress += n / wordBytes;
+        }
+    }
+    return true;
+}
+
+bool dsp_writeBlock(uint16_t subaddress, const uint8_t* data, size_t length) {
+    return dsp_writeBlockTo(g_dsp_address, subaddress, data, length);
+}
+
+bool dsp_readBlock(uint16_t subaddress, uint8_t* buffer, size_t length) {
+    return dsp_readBlockFrom(g_dsp_address, subaddress, buffer, length);
+}
+
+// Parameter RAM words (5.23 fixed point, big-endian on the bus)
+bool dsp_writeParamWords(uint16_t paramAddr, const int32_t* words, size_t count) {
+    if (count == 0 || paramAddr + count > ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    const size_t WORDS_PER_BURST = DSP_BURST_MAX_DATA / ADAU1701_PARAM_WORD_BYTES;
+    uint8_t buf[DSP_BURST_MAX_DATA];
+    size_t done = 0;
+    while (done < count) {
+        size_t n = min(WORDS_PER_BURST, count - done);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t w = (uint32_t)words[done + i];
+            buf[i * 4 + 0] = (uint8_t)(w >> 24);
+            buf[i * 4 + 1] = (uint8_t)(w >> 16);
+            buf[i * 4 + 2] = (uint8_t)(w >> 8);
+            buf[i * 4 + 3] = (uint8_t)w;
+        }
+        if (!dsp_writeBlock(paramAddr + done, buf, n * ADAU1701_PARAM_WORD_BYTES)) {
+            return false;
+        }
+        done += n;
+    }
+    return true;
+}
+
+bool dsp_readParamWords(uint16_t paramAddr, int32_t* words, size_t count) {
+    if (count == 0 || paramAddr + count > ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    const size_t WORDS_PER_BURST = DSP_BURST_MAX_DATA / ADAU1701_PARAM_WORD_BYTES;
+    uint8_t buf[DSP_BURST_MAX_DATA];
+    size_t done = 0;
+    while (done < count) {
+        size_t n = min(WORDS_PER_BURST, count - done);
+        if (!dsp_readBlock(paramAddr + done, buf, n * ADAU1701_PARAM_WORD_BYTES)) {
+            return false;
+        }
+        for (size_t i = 0; i < n; i++) {
+            words[done + i] = (int32_t)(((uint32_t)buf[i * 4] << 24) | ((uint32_t)buf[i * 4 + 1] << 16) |
+                                        ((uint32_t)buf[i * 4 + 2] << 8) | buf[i * 4 + 3]);
+        }
+        done += n;
+    }
+    return true;
+}
+
+// Program RAM words (5 raw bytes each, count in words)
+bool dsp_writeProgramWords(uint16_t progAddr, const uint8_t* words, size_t count) {
+    if (count == 0 || progAddr < ADAU1701_PROG_RAM_START ||
+        progAddr + count > ADAU1701_PROG_RAM_START + ADAU1701_PROG_RAM_WORDS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+    return dsp_writeBlock(progAddr, words, count * ADAU1701_PROG_WORD_BYTES);
+}
+
+bool dsp_readProgramWords(uint16_t progAddr, uint8_t* words, size_t count) {
+    if (count == 0 || progAddr < ADAU1701_PROG_RAM_START ||
+        progAddr + count > ADAU1701_PROG_RAM_START + ADAU1701_PROG_RAM_WORDS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+    return dsp_readBlock(progAddr, words, count * ADAU1701_PROG_WORD_BYTES);
+}
+
 // Set DSP core run state
 bool dsp_setRunState(bool run) {
     uint8_t controlValue = run ? 0x00 : ADAU1701_CR_RUN; // 0=running, 1=reset/stopped
@@ -178,6 +417,7 @@ bool dsp_setRunState(bool run) {
 // Perform soft reset (toggle reset bit)
 bool dsp_softReset() {
     Serial.println("DSP: Performing soft reset");
+    dsp_shadowInvalidate(); // Parameters may be reloaded from EEPROM
 
     // Set reset bit (stop core)
     if (!dsp_writeRegisterVerified(ADAU1701_REG_CONTROL, ADAU1701_CR_RUN)) {
@@ -196,99 +436,619 @@ bool dsp_softReset() {
     return true;
 }
 
-// Perform hard reset (requires hardware reset pin)
+// Hard reset and boot profiling state
+static DSPBootProfile g_boot_profile;
+static uint32_t g_boot_baseline_us = 0;
+
+bool dsp_resetPinAllowed(int pin) {
+    static const int8_t choices[] = DSP_RESET_PIN_CHOICES;
+    static const int inUse[] = {SDA_PIN, SCL_PIN, I2C1_SDA_PIN, I2C1_SCL_PIN,
+                                EMU_SDA_PIN, EMU_SCL_PIN, EEPROM_WP_PIN};
+    if (pin == -1) {
+        return true;
+    }
+    for (int used : inUse) {
+        if (pin == used) {
+            return false;
+        }
+    }
+    for (int8_t choice : choices) {
+        if (pin == choice) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool dsp_setResetPin(int8_t pin) {
+    if (!dsp_resetPinAllowed(pin)) {
+        Serial.printf("DSP: GPIO %d refused as reset pin\n", pin);
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+    g_dsp_reset_pin = pin;
+    if (pin >= 0) {
+        digitalWrite(pin, HIGH);
+        pinMode(pin, OUTPUT);
+    }
+    return true;
+}
+
+int8_t dsp_getResetPin() {
+    return g_dsp_reset_pin;
+}
+
+// Poll core control from reset release until the control port answers
+// and CR reads back set. While the DSP is self-booting it owns the bus,
+// so unacknowledged polls are expected. Each poll takes the bus lock on
+// its own; other callers see NACKs during the boot instead of waiting
+// out DSP_BOOT_TIMEOUT_MS behind the profiler.
+static bool dsp_pollBoot(unsigned long releaseUs, bool hardReset) {
+    DSPBootProfile& p = g_boot_profile;
+    memset(&p, 0, sizeof(p));
+    p.hardReset = hardReset;
+    p.firstAckUs = p.coreRunningUs = -1;
+
+    uint32_t elapsed = 0;
+    while (elapsed < DSP_BOOT_TIMEOUT_MS * 1000UL) {
+        uint8_t cc[2];
+        bool ok = dsp_readBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc));
+        elapsed = micros() - releaseUs;
+        p.polls++;
+
+        if (!ok) {
+            p.busyPolls++;
+        } else {
+            p.coreControl = ((uint16_t)cc[0] << 8) | cc[1];
+            if (p.firstAckUs < 0) p.firstAckUs = elapsed;
+            if ((p.coreControl & ADAU1701_CORE_CONTROL_CR) && p.coreRunningUs < 0) p.coreRunningUs = elapsed;
+            if (p.coreRunningUs >= 0) {
+                p.complete = true;
+                break;
+            }
+        }
+        delayMicroseconds(DSP_BOOT_POLL_US);
+    }
+    p.totalUs = elapsed;
+
+    p.reloaded = hardReset && p.complete;
+
+    if (p.complete && g_boot_baseline_us &&
+        p.totalUs > g_boot_baseline_us + g_boot_baseline_us / 100 * DSP_BOOT_REGRESSION_PCT) {
+        p.regression = true;
+        Serial.printf("DSP: Boot took %lu us, baseline %lu us\n",
+                      (unsigned long)p.totalUs, (unsigned long)g_boot_baseline_us);
+    }
+    Serial.printf("DSP: Boot %s in %lu us (%u polls, %u busy)\n", p.complete ? "complete" : "timed out",
+                  (unsigned long)p.totalUs, p.polls, p.busyPolls);
+
+    dsp_sampleStatus();
+    return p.complete;
+}
+
+// Perform hard reset (requires hardware reset pin).
+// Pulse /RESET low; with SELFBOOT high the DSP reloads from EEPROM on release
 bool dsp_hardReset() {
-    // Note: This would require a hardware reset pin connection
-    // For now, fall back to soft reset
-    Serial.println("DSP: Hard reset not implemented, using soft reset");
-    return dsp_softReset();
+    if (g_dsp_reset_pin < 0) {
+        Serial.println("DSP: No reset pin configured, using soft reset");
+        return dsp_softReset();
+    }
+
+    Serial.printf("DSP: Hard reset via GPIO %d\n", g_dsp_reset_pin);
+    dsp_shadowInvalidate();
+
+    // No transaction may be mid-flight when /RESET drops
+    uint8_t bus = dsp_busLock();
+    pinMode(g_dsp_reset_pin, OUTPUT);
+    digitalWrite(g_dsp_reset_pin, LOW);
+    delayMicroseconds(DSP_RESET_PULSE_US);
+    digitalWrite(g_dsp_reset_pin, HIGH);
+    unsigned long releaseUs = micros();
+    dsp_busUnlock(bus);
+    return dsp_pollBoot(releaseUs, true);
+}
+
+bool dsp_canSelfBoot() {
+    return g_dsp_reset_pin >= 0;
 }
 
 // Trigger self-boot from EEPROM
 bool dsp_selfBoot() {
+    if (!dsp_canSelfBoot()) {
+        Serial.println("DSP: No reset pin configured - cannot self-boot");
+        return false;
+    }
     Serial.println("DSP: Triggering self-boot from EEPROM");
 
     // Ensure EEPROM write protect is disabled for self-boot
     setWriteProtect(true); // WP high for self-boot
 
     // Perform reset to trigger boot from EEPROM
-    return dsp_softReset();
+    return dsp_profileBoot();
 }
 
-// Safeload write for parameter RAM (more reliable than direct writes)
-bool dsp_safeloadWrite(uint16_t paramAddr, uint8_t* data, size_t count) {
-    if (count > 5 || count == 0) {
-        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+// Reset and time the boot: GPIO reset when wired, otherwise hold and
+// release the core through CR in core control (which restarts the core but
+// cannot time a real EEPROM reload - the DSP only self-boots from reset)
+bool dsp_profileBoot() {
+    if (g_dsp_reset_pin >= 0) {
+        return dsp_hardReset();
+    }
+
+    uint8_t cc[2];
+    if (!dsp_readBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc))) {
+        return false;
+    }
+    cc[1] &= ~ADAU1701_CORE_CONTROL_IST;
+    uint8_t held[2] = {cc[0], (uint8_t)(cc[1] & ~ADAU1701_CORE_CONTROL_CR)};
+    if (!dsp_writeBlock(ADAU1701_CORE_CONTROL_REG, held, sizeof(held))) {
+        return false;
+    }
+    delay(DSP_RESET_DELAY_MS);
+    cc[1] |= ADAU1701_CORE_CONTROL_CR;
+    if (!dsp_writeBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc))) {
         return false;
     }
+    return dsp_pollBoot(micros(), false);
+}
+
+const DSPBootProfile& dsp_getBootProfile() {
+    return g_boot_profile;
+}
+
+void dsp_setBootBaseline(uint32_t totalUs) {
+    g_boot_baseline_us = totalUs ? totalUs : g_boot_profile.totalUs;
+}
+
+uint32_t dsp_getBootBaseline() {
+    return g_boot_baseline_us;
+}
+
+// Safeload slots staged for one transfer
+struct DSPSafeloadStage {
+    uint8_t data[ADAU1701_SAFELOAD_SLOTS * ADAU1701_SAFELOAD_DATA_BYTES];
+    uint8_t addr[ADAU1701_SAFELOAD_SLOTS * 2];
+    uint8_t slots;
+};
+
+// Staging of the legacy dsp_safeloadWrite/dsp_safeloadTrigger pair, under
+// dsp_busLock. Batches stage on their own stack so a timer task never
+// shares slots with a main-loop caller.
+static DSPSafeloadStage g_safeload_stage = {{0}, {0}, 0};
+static DSPSafeloadStats g_safeload_stats = {0, 0, 0, 0, 0};
+
+// Wait for the previous transfer to finish (IST clears at the next frame)
+static bool dsp_safeloadWaitIdle(uint8_t devAddr, uint16_t& coreControl) {
+    unsigned long startTime = micros();
+    uint8_t buf[2];
 
-    // Wait for safeload ready
-    uint8_t status;
-    unsigned long startTime = millis();
     while (true) {
-        if (!dsp_readRegister(ADAU1701_REG_STATUS, status)) {
+        if (!dsp_readBlockFrom(devAddr, ADAU1701_CORE_CONTROL_REG, buf, sizeof(buf))) {
             return false;
         }
-        if (status & ADAU1701_SR_SAFELOAD_RDY) {
-            break; // Ready
+        coreControl = ((uint16_t)buf[0] << 8) | buf[1];
+        if (!(coreControl & ADAU1701_CORE_CONTROL_IST)) {
+            return true;
         }
-        if (millis() - startTime > 1000) { // 1 second timeout
-            Serial.println("DSP: Safeload timeout");
+        if (micros() - startTime > DSP_SAFELOAD_TIMEOUT_US) {
+            Serial.printf("DSP: Safeload timeout at 0x%02X\n", devAddr);
+            dsp_setLastError(DSP_ERR_I2C_TIMEOUT);
             return false;
         }
-        delay(10);
+        delayMicroseconds(20);
     }
+}
 
-    // Write parameter address (big-endian)
-    uint8_t addrHigh = (paramAddr >> 8) & 0xFF;
-    uint8_t addrLow = paramAddr & 0xFF;
+// Stage one parameter in the next free slot (data right-aligned)
+static bool dsp_safeloadStage(DSPSafeloadStage& stage, uint16_t paramAddr, const uint8_t* data, size_t count) {
+    if (count > ADAU1701_SAFELOAD_DATA_BYTES || count == 0 ||
+        stage.slots >= ADAU1701_SAFELOAD_SLOTS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    uint8_t* slotData = &stage.data[stage.slots * ADAU1701_SAFELOAD_DATA_BYTES];
+    memset(slotData, 0, ADAU1701_SAFELOAD_DATA_BYTES);
+    memcpy(slotData + ADAU1701_SAFELOAD_DATA_BYTES - count, data, count);
 
-    if (!dsp_writeRegister(ADAU1701_REG_SAFEDATA0, addrHigh)) return false;
-    if (!dsp_writeRegister(ADAU1701_REG_SAFEDATA1, addrLow)) return false;
+    stage.addr[stage.slots * 2] = (uint8_t)(paramAddr >> 8);
+    stage.addr[stage.slots * 2 + 1] = (uint8_t)(paramAddr & 0xFF);
+    stage.slots++;
+    return true;
+}
 
-    // Write data bytes
+bool dsp_safeloadWrite(uint16_t paramAddr, uint8_t* data, size_t count) {
+    uint8_t bus = dsp_busLock();
+    bool ok = dsp_safeloadStage(g_safeload_stage, paramAddr, data, count);
+    dsp_busUnlock(bus);
+    return ok;
+}
+
+// Transfer the staged slots to each device still ok: data and address
+// registers everywhere first, then IST back to back so the devices swap in
+// the new values as close together as the bus allows. skewUs is the time
+// between the first and last IST write. A device that fails is marked and
+// skipped; the others still get the transfer. Returns true if every device
+// took it. The stage is emptied either way. Caller holds dsp_busLock.
+static bool dsp_safeloadTransfer(DSPSafeloadStage& stage, DSPBroadcastResult* devs, uint8_t devCount, uint32_t& skewUs) {
+    uint16_t coreControl[DSP_MAX_TARGETS];
+    skewUs = 0;
+    if (stage.slots == 0) {
+        return true;
+    }
+
+    bool ok = true;
+    for (uint8_t d = 0; d < devCount; d++) {
+        if (devs[d].ok) {
+            devs[d].ok = dsp_safeloadWaitIdle(devs[d].address, coreControl[d]) &&
+                         dsp_writeBlockTo(devs[d].address, ADAU1701_SAFELOAD_DATA_REG, stage.data,
+                                          stage.slots * ADAU1701_SAFELOAD_DATA_BYTES) &&
+                         dsp_writeBlockTo(devs[d].address, ADAU1701_SAFELOAD_ADDR_REG, stage.addr, stage.slots * 2);
+        }
+        ok &= devs[d].ok;
+    }
+
+    unsigned long firstUs = 0;
+    bool applied = false;
+    for (uint8_t d = 0; d < devCount; d++) {
+        if (!devs[d].ok) {
+            continue;
+        }
+        uint16_t cc = coreControl[d] | ADAU1701_CORE_CONTROL_IST;
+        uint8_t buf[2] = {(uint8_t)(cc >> 8), (uint8_t)(cc & 0xFF)};
+        devs[d].ok = dsp_writeBlockTo(devs[d].address, ADAU1701_CORE_CONTROL_REG, buf, sizeof(buf));
+        unsigned long now = micros();
+        if (!applied) {
+            firstUs = now;
+        }
+        skewUs = now - firstUs;
+        if (!devs[d].ok) {
+            Serial.printf("DSP: Safeload IST failed at 0x%02X\n", devs[d].address);
+            ok = false;
+            continue;
+        }
+        applied = true;
+        devs[d].transfers++;
+        for (uint8_t slot = 0; devs[d].address == g_dsp_address && slot < stage.slots; slot++) {
+            uint16_t addr = ((uint16_t)stage.addr[slot * 2] << 8) | stage.addr[slot * 2 + 1];
+            dsp_shadowStore(addr, &stage.data[slot * ADAU1701_SAFELOAD_DATA_BYTES + 1]);
+        }
+    }
+
+    if (applied) {
+        g_safeload_stats.triggers++;
+    }
+    stage.slots = 0;
+    return ok;
+}
+
+static bool dsp_anyDeviceOk(const DSPBroadcastResult* devs, uint8_t devCount) {
+    for (uint8_t d = 0; d < devCount; d++) {
+        if (devs[d].ok) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Transfer all staged slots: data and address registers as two bursts,
+// then set IST so the DSP swaps them in between audio frames
+bool dsp_safeloadTrigger() {
+    uint32_t skewUs;
+    DSPBroadcastResult dev = {g_dsp_address, 0, true};
+    uint8_t bus = dsp_busLock();
+    bool ok = dsp_safeloadTransfer(g_safeload_stage, &dev, 1, skewUs);
+    dsp_busUnlock(bus);
+    return ok;
+}
+
+// Stage and transfer parameter words five at a time to each device.
+// Returns the number of words applied to the devices still ok (see
+// devs[].ok); maxSkewUs is the worst IST skew.
+static size_t dsp_safeloadBatches(DSPBroadcastResult* devs, uint8_t devCount,
+                                  const DSPParamWrite* params, size_t count, uint32_t& maxSkewUs) {
     for (size_t i = 0; i < count; i++) {
-        if (!dsp_writeRegister(ADAU1701_REG_SAFEDATA2 + i, data[i])) return false;
+        if (params[i].address >= ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+            dsp_setLastError(DSP_ERR_INVALID_PARAM);
+            return 0;
+        }
+    }
+
+    uint8_t bus = dsp_busLock();
+    unsigned long startTime = micros();
+    size_t done = 0;
+    maxSkewUs = 0;
+    while (done < count) {
+        size_t n = min((size_t)ADAU1701_SAFELOAD_SLOTS, count - done);
+        DSPSafeloadStage stage;
+        stage.slots = 0;
+        bool staged = true;
+        for (size_t i = 0; i < n && staged; i++) {
+            uint32_t v = (uint32_t)params[done + i].value;
+            uint8_t word[4] = {(uint8_t)(v >> 24), (uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v};
+            staged = dsp_safeloadStage(stage, params[done + i].address, word, sizeof(word));
+        }
+        uint32_t skewUs;
+        if (!staged) {
+            break;
+        }
+        dsp_safeloadTransfer(stage, devs, devCount, skewUs);
+        if (!dsp_anyDeviceOk(devs, devCount)) {
+            break;
+        }
+        maxSkewUs = max(maxSkewUs, skewUs);
+        done += n;
     }
 
-    // Pad with zeros if less than 5 bytes
-    for (size_t i = count; i < 5; i++) {
-        if (!dsp_writeRegister(ADAU1701_REG_SAFEDATA2 + i, 0x00)) return false;
+    uint32_t elapsed = micros() - startTime;
+    g_safeload_stats.params += done;        // Under the lock: timer and loop() both land here
+    g_safeload_stats.busyUs += elapsed;
+    g_safeload_stats.lastParams = done;
+    g_safeload_stats.lastUs = elapsed;
+    dsp_busUnlock(bus);
+    return done;
+}
+
+// Apply any number of parameter words, five per safeload transfer
+bool dsp_safeloadParams(const DSPParamWrite* params, size_t count) {
+    if (count == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
     }
+    uint32_t skewUs;
+    DSPBroadcastResult dev = {g_dsp_address, 0, true};
+    return dsp_safeloadBatches(&dev, 1, params, count, skewUs) == count && dev.ok;
+}
 
+const DSPSafeloadStats& dsp_getSafeloadStats() {
+    return g_safeload_stats;
+}
+
+// Additional DSP targets sharing the bus. Target 0 is always the primary
+// device (g_dsp_address); its groups live in g_dsp_primary_groups.
+static DSPTarget g_dsp_targets[DSP_MAX_TARGETS];
+static uint8_t g_dsp_target_count = 1;
+static uint8_t g_dsp_primary_groups = DSP_GROUP_ALL;
+static DSPBroadcastStats g_broadcast_stats = {};
+
+bool dsp_addTarget(uint8_t address, uint8_t groups) {
+    if (address == 0 || address > 0x7F || groups == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+    if (address == g_dsp_address) {
+        g_dsp_primary_groups = groups;
+        return true;
+    }
+    for (uint8_t i = 1; i < g_dsp_target_count; i++) {
+        if (g_dsp_targets[i].address == address) {
+            g_dsp_targets[i].groups = groups;
+            return true;
+        }
+    }
+    if (g_dsp_target_count >= DSP_MAX_TARGETS) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    uint8_t bus = dsp_busLock();
+    i2c_wire(bus).beginTransmission(address);
+    bool present = (i2c_wire(bus).endTransmission() == 0);
+    dsp_busUnlock(bus);
+
+    DSPTarget& t = g_dsp_targets[g_dsp_target_count++];
+    t.address = address;
+    t.groups = groups;
+    t.present = present;
+    Serial.printf("DSP: Target 0x%02X groups 0x%02X %s\n", address, groups,
+                  present ? "present" : "not responding");
     return true;
 }
 
-// Trigger safeload operation
-bool dsp_safeloadTrigger() {
-    return dsp_writeRegister(ADAU1701_REG_SAFELOAD, 0x01);
+void dsp_clearTargets() {
+    g_dsp_target_count = 1;
+    g_dsp_primary_groups = DSP_GROUP_ALL;
 }
 
-// Get comprehensive DSP status
-DSPStatus dsp_getStatus() {
-    DSPStatus status = {false, 0, 0, 0, 0, false, false, false, false};
+uint8_t dsp_getTargetCount() {
+    return g_dsp_target_count;
+}
 
-    status.detected = dsp_detect();
+DSPTarget dsp_getTarget(uint8_t index) {
+    if (index == 0) {
+        DSPTarget primary = {g_dsp_address, g_dsp_primary_groups, g_dsp_initialized};
+        return primary;
+    }
+    return index < g_dsp_target_count ? g_dsp_targets[index] : DSPTarget{0, 0, false};
+}
 
-    if (!status.detected) {
-        return status;
+// Devices selected by a group mask, in target order. Their results live in
+// the broadcast stats so a failed call still reports each device.
+static DSPBroadcastResult* dsp_selectTargets(uint8_t groupMask, uint8_t& devCount) {
+    DSPBroadcastResult* devs = g_broadcast_stats.lastResults;
+    devCount = 0;
+    for (uint8_t i = 0; i < g_dsp_target_count; i++) {
+        DSPTarget t = dsp_getTarget(i);
+        if (t.groups & groupMask) {
+            devs[devCount++] = {t.address, 0, true};
+        }
+    }
+    g_broadcast_stats.lastTargets = devCount;
+    return devs;
+}
+
+static void dsp_recordBroadcast(uint32_t skewUs) {
+    g_broadcast_stats.broadcasts++;
+    g_broadcast_stats.lastSkewUs = skewUs;
+    g_broadcast_stats.maxSkewUs = max(g_broadcast_stats.maxSkewUs, skewUs);
+    if (skewUs > DSP_BROADCAST_SKEW_MAX_US) {
+        g_broadcast_stats.overBound++;
+        Serial.printf("DSP: Broadcast skew %lu us exceeds %u us\n",
+                      (unsigned long)skewUs, DSP_BROADCAST_SKEW_MAX_US);
+    }
+}
+
+// Identical burst to every device in the group, chunk by chunk so each
+// device receives a chunk back to back with the others. The bus runs at
+// the fast clock for the duration to keep the skew small.
+bool dsp_broadcastBlock(uint8_t groupMask, uint16_t subaddress, const uint8_t* data, size_t length) {
+    uint8_t devCount;
+    DSPBroadcastResult* devs = dsp_selectTargets(groupMask, devCount);
+    size_t wordBytes = dsp_memoryWordBytes(subaddress);
+    size_t maxChunk = dsp_burstChunkBytes(subaddress, length);
+    if (devCount == 0 || maxChunk == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
     }
 
-    // Read registers
-    dsp_readRegister(ADAU1701_REG_HW_ID, status.hardwareId);
-    dsp_readRegister(ADAU1701_REG_SW_ID, status.softwareId);
-    dsp_readRegister(ADAU1701_REG_CONTROL, status.controlReg);
-    dsp_readRegister(ADAU1701_REG_STATUS, status.statusReg);
+    uint8_t bus = dsp_busLock();
+    i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+    uint32_t maxSkewUs = 0;
+    size_t done = 0;
+    while (done < length && dsp_anyDeviceOk(devs, devCount)) {
+        size_t n = min(maxChunk, length - done);
+        unsigned long firstUs = 0;
+        bool first = true;
+        for (uint8_t d = 0; d < devCount; d++) {
+            if (!devs[d].ok) {
+                continue;
+            }
+            devs[d].ok = dsp_writeBlockTo(devs[d].address, subaddress, data + done, n);
+            unsigned long now = micros();
+            if (first) {
+                firstUs = now;
+                first = false;
+            }
+            maxSkewUs = max(maxSkewUs, (uint32_t)(now - firstUs));
+            if (devs[d].ok) {
+                devs[d].transfers++;
+            } else {
+                Serial.printf("DSP: Broadcast write failed at 0x%02X\n", devs[d].address);
+            }
+        }
+        done += n;
+        if (wordBytes) {
+            subaddress += n / wordBytes;
+        }
+    }
+    i2c_setClock(bus, 0);
+    dsp_busUnlock(bus);
+
+    bool ok = done == length;
+    for (uint8_t d = 0; d < devCount; d++) {
+        ok &= devs[d].ok;
+    }
+    if (ok) {
+        dsp_recordBroadcast(maxSkewUs);
+    }
+    return ok;
+}
+
+// Batched safeload to every device in the group: slots are staged on all
+// devices before any IST is set, so skew is only the IST writes themselves
+bool dsp_broadcastSafeload(uint8_t groupMask, const DSPParamWrite* params, size_t count) {
+    uint8_t devCount;
+    DSPBroadcastResult* devs = dsp_selectTargets(groupMask, devCount);
+    if (devCount == 0 || count == 0) {
+        dsp_setLastError(DSP_ERR_INVALID_PARAM);
+        return false;
+    }
+
+    uint8_t bus = dsp_busLock();
+    i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+    uint32_t skewUs;
+    bool ok = dsp_safeloadBatches(devs, devCount, params, count, skewUs) == count;
+    i2c_setClock(bus, 0);
+    dsp_busUnlock(bus);
+
+    for (uint8_t d = 0; d < devCount; d++) {
+        ok &= devs[d].ok;
+    }
+    if (ok) {
+        dsp_recordBroadcast(skewUs);
+    }
+    return ok;
+}
+
+const DSPBroadcastStats& dsp_getBroadcastStats() {
+    return g_broadcast_stats;
+}
 
-    // Interpret status bits
-    status.coreRunning = !(status.controlReg & ADAU1701_CR_RUN);
-    status.pllLocked = (status.statusReg & ADAU1701_SR_PLL_LOCKED) != 0;
-    status.dckStable = (status.statusReg & ADAU1701_SR_DCK_STABLE) != 0;
-    status.safeloadReady = (status.statusReg & ADAU1701_SR_SAFELOAD_RDY) != 0;
+// Float to 5.23 fixed point, saturating at the format limits. The DSP only
+// sees the low 28 bits, so values must stay inside [-16.0, 16.0).
+int32_t dsp_floatTo523(float value) {
+    const float scale = 8388608.0f;                  // 2^23
+    const int32_t maxWord = 0x07FFFFFF;              // 16.0 - 2^-23
+    const int32_t minWord = (int32_t)0xF8000000;     // -16.0
+    if (isnan(value)) return 0;
+    if (value >= 16.0f) return maxWord;
+    if (value <= -16.0f) return minWord;
+    long word = lroundf(value * scale);              // May round up to 16.0
+    return (int32_t)max((long)minWord, min((long)maxWord, word));
+}
 
+// Read core control and interpret its bits
+static bool dsp_readCoreStatus(DSPStatus& status) {
+    uint8_t cc[2];
+    if (!dsp_readBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc))) {
+        return false;
+    }
+    status.coreControl = ((uint16_t)cc[0] << 8) | cc[1];
+    status.coreRunning = (status.coreControl & ADAU1701_CORE_CONTROL_CR) != 0;
+    status.safeloadPending = (status.coreControl & ADAU1701_CORE_CONTROL_IST) != 0;
+    return true;
+}
+
+DSPStatus dsp_getStatus() {
+    DSPStatus status = {false, 0, false, false};
+    status.detected = dsp_detect() && dsp_readCoreStatus(status);
     return status;
 }
 
+// Status sampler state (served to HTTP handlers without bus access)
+static DSPStatusSnapshot g_status_snapshot;
+static uint32_t g_status_interval_ms = DSP_STATUS_SAMPLE_MS;
+
+// One read of core control. The address sweep in dsp_detect() only runs
+// while the DSP is missing; a present DSP costs one read.
+bool dsp_sampleStatus() {
+    DSPStatusSnapshot& snap = g_status_snapshot;
+    unsigned long startTime = micros();
+
+    bool ok = (snap.status.detected || dsp_detect()) && dsp_readCoreStatus(snap.status);
+
+    snap.status.detected = ok;
+    if (!ok) {
+        snap.failures++;
+    }
+
+    snap.samples++;
+    snap.sampledMs = millis();
+    snap.sampleUs = micros() - startTime;
+    return ok;
+}
+
+void dsp_statusService() {
+    if (g_status_interval_ms == 0) {
+        return;
+    }
+    if (g_status_snapshot.samples == 0 || millis() - g_status_snapshot.sampledMs >= g_status_interval_ms) {
+        dsp_sampleStatus();
+    }
+}
+
+const DSPStatusSnapshot& dsp_getStatusSnapshot() {
+    return g_status_snapshot;
+}
+
+void dsp_setStatusSampleInterval(uint32_t intervalMs) {
+    g_status_interval_ms = intervalMs;
+}
+
+uint32_t dsp_getStatusSampleInterval() {
+    return g_status_interval_ms;
+}
+
 // Print detailed DSP status
 void dsp_printStatus() {
     DSPStatus status = dsp_getStatus();
@@ -302,15 +1062,9 @@ void dsp_printStatus() {
     }
 
     Serial.printf("I2C Address: 0x%02X\n", g_dsp_address);
-    Serial.printf("Hardware ID: 0x%02X %s\n", status.hardwareId,
-                 status.hardwareId == 0x02 ? "(ADAU1701)" : "(UNKNOWN)");
-    Serial.printf("Software ID: 0x%02X\n", status.softwareId);
-    Serial.printf("Control Reg: 0x%02X\n", status.controlReg);
-    Serial.printf("  - Core State: %s\n", status.coreRunning ? "RUNNING" : "STOPPED/RESET");
-    Serial.printf("Status Reg: 0x%02X\n", status.statusReg);
-    Serial.printf("  - DCK Stable: %s\n", status.dckStable ? "YES" : "NO");
-    Serial.printf("  - PLL Locked: %s\n", status.pllLocked ? "YES" : "NO");
-    Serial.printf("  - Safeload Ready: %s\n", status.safeloadReady ? "YES" : "NO");
+    Serial.printf("Core Control: 0x%04X\n", status.coreControl);
+    Serial.printf("  - Core State: %s\n", status.coreRunning ? "RUNNING" : "HELD (CR clear)");
+    Serial.printf("  - Safeload: %s\n", status.safeloadPending ? "PENDING" : "IDLE");
     Serial.println("========================\n");
 }
 
@@ -347,11 +1101,31 @@ String dsp_getErrorString(int errorCode) {
     }
 }
 
+// Serialize bus access between the main loop and timer/task callers.
+// Recursive, so a safeload batch can hold it across its inner transfers.
+// Returns the bus the DSP is routed to; rerouting is refused while the lock
+// is held, so the bus stays valid until the matching dsp_busUnlock(bus).
+uint8_t dsp_busLock() {
+    return i2c_lockDevice(I2C_DEVICE_DSP);
+}
+
+bool dsp_busTryLock(uint32_t waitMs, uint8_t& bus) {
+    return i2c_tryLockDevice(I2C_DEVICE_DSP, waitMs, bus);
+}
+
+void dsp_busUnlock(uint8_t bus) {
+    i2c_unlock(bus);
+}
+
 // Set last error code
 static void dsp_setLastError(int error) {
     g_last_error = error;
 }
 
+int dsp_getLastError() {
+    return g_last_error;
+}
+
 // Legacy compatibility functions
 bool setDSPRunState(bool run) {
     return dsp_setRunState(run);
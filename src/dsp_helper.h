@@ -29,23 +29,131 @@
 #define ADAU1701_SR_PLL_LOCKED       0x04    // PLL locked
 #define ADAU1701_SR_SAFELOAD_RDY     0x08    // Safeload ready
 
+// ADAU1701 Memory Map (subaddresses used by self-boot and burst writes)
+#define ADAU1701_PARAM_RAM_START     0x0000  // Parameter RAM, 1024 words
+#define ADAU1701_PARAM_RAM_WORDS     1024
+#define ADAU1701_PARAM_WORD_BYTES    4       // 5.23 fixed point, 4 bytes per word
+#define ADAU1701_PROG_RAM_START      0x0400  // Program RAM, 1024 words
+#define ADAU1701_PROG_RAM_WORDS      1024
+#define ADAU1701_PROG_WORD_BYTES     5       // 40-bit instruction words
+#define ADAU1701_HW_REG_START        0x0800  // Control registers
+#define ADAU1701_HW_REG_END          0x0827  // Last control register
+
+// ADAU1701 Safeload: five slots of 5-byte data + 2-byte target address,
+// transferred together when IST is set in the core control register
+#define ADAU1701_SAFELOAD_DATA_REG   0x0810  // Safeload data slots 0-4
+#define ADAU1701_SAFELOAD_ADDR_REG   0x0815  // Safeload address slots 0-4
+#define ADAU1701_CORE_CONTROL_REG    0x081C  // DSP core control (2 bytes)
+#define ADAU1701_CORE_CONTROL_IST    0x0020  // Initiate safeload transfer
+#define ADAU1701_CORE_CONTROL_CR     0x0004  // Clear registers: 0 holds the core (RAM loads)
+#define ADAU1701_SAFELOAD_SLOTS      5
+#define ADAU1701_SAFELOAD_DATA_BYTES 5
+
+// ADAU1701 Data capture (readback): writing a 2-byte select word picks a
+// program step (bits 11:2) and the register tapped there (bits 1:0); the
+// register then reads back that value every sample as 3 bytes of 5.19
+#define ADAU1701_DATA_CAPTURE_REG    0x081A  // Data capture registers 0-1
+#define ADAU1701_DATA_CAPTURE_REGS   2
+#define ADAU1701_CAPTURE_SELECT_MAX  0x0FFF
+#define ADAU1701_CAPTURE_DATA_BYTES  3
+
+// ADAU1701 Self-boot EEPROM message format
+// Write message: type, 2-byte length (device address + subaddress + data),
+// device address byte, 2-byte subaddress, data bytes.
+#define ADAU1701_BOOT_MSG_END        0x00    // End of self-boot image
+#define ADAU1701_BOOT_MSG_WRITE      0x01    // Write block to DSP memory
+#define ADAU1701_BOOT_MSG_DELAY      0x02    // Delay (2-byte count)
+#define ADAU1701_BOOT_MSG_NOP        0x03    // No operation (single byte)
+#define ADAU1701_BOOT_DEVICE_ADDR    0x00    // Device address byte in write messages
+
 // DSP Communication Configuration
 #define DSP_I2C_TIMEOUT_MS          100     // I2C timeout
 #define DSP_WRITE_VERIFY_RETRIES    3       // Number of write verification retries
 #define DSP_RESET_DELAY_MS          50      // Delay after reset operations
-#define DSP_COMM_DELAY_US           10      // Microsecond delay between operations
+#define DSP_STATUS_SAMPLE_MS        1000    // Default status sampler period (0 = off)
+#define DSP_SAFELOAD_TIMEOUT_US     2000    // Wait for previous safeload transfer
+#define DSP_BOOT_TIMEOUT_MS         3000    // Self-boot of a full 32KB EEPROM fits well inside
+#define DSP_BOOT_POLL_US            500     // Status poll period while profiling a boot
+#define DSP_BOOT_REGRESSION_PCT     20      // Boot slower than baseline by this much is flagged
+#define DSP_BURST_MAX_DATA          120     // Data bytes per burst (fits Wire buffer; multiple of 4 and 5)
+#define DSP_MAX_TARGETS             4       // ADAU1701 devices on the bus (ADDR0/ADDR1 pins)
+#define DSP_GROUP_ALL               0xFF    // Group mask selecting every target
+#define DSP_BROADCAST_SKEW_MAX_US   250     // Inter-device skew bound (IST writes at fast clock)
 
 // DSP State Structure
+// What the control port can actually report: core control (0x081C). The
+// ADAU1701 has no readable ID, PLL or clock status register.
 struct DSPStatus {
     bool detected;
-    uint8_t hardwareId;
-    uint8_t softwareId;
-    uint8_t controlReg;
-    uint8_t statusReg;
-    bool coreRunning;
-    bool pllLocked;
-    bool dckStable;
-    bool safeloadReady;
+    uint16_t coreControl;   // ADAU1701_CORE_CONTROL_REG
+    bool coreRunning;       // CR set
+    bool safeloadPending;   // IST not yet cleared by the core
+};
+
+// Timestamped status kept by the background sampler
+struct DSPStatusSnapshot {
+    DSPStatus status;
+    uint32_t sampledMs;     // millis() of the last sample
+    uint32_t sampleUs;      // Bus time of the last sample
+    uint32_t samples;
+    uint32_t failures;
+};
+
+// Reset-to-audio milestones of the last boot, in us from reset release
+// (-1 = not observed before the timeout). The ADAU1701 has no readable
+// PLL or clock status, so these are the milestones the control port
+// shows: the port answering again (the DSP has finished mastering the bus
+// for its EEPROM load) and core control reporting the core running.
+struct DSPBootProfile {
+    bool hardReset;         // GPIO /RESET (false: core restart via core control)
+    bool complete;          // Control port answering and core running
+    bool reloaded;          // Program reloaded from EEPROM (false: core restart only)
+    bool regression;        // Slower than the baseline by DSP_BOOT_REGRESSION_PCT
+    int32_t firstAckUs;     // DSP answers on the bus again
+    int32_t coreRunningUs;  // CR set in core control (0x081C)
+    uint16_t coreControl;   // Last core control value read
+    uint32_t totalUs;       // Until complete, or the timeout
+    uint16_t polls;
+    uint16_t busyPolls;     // Polls not acknowledged (DSP still booting)
+};
+
+// One parameter RAM word for batched safeload
+struct DSPParamWrite {
+    uint16_t address;
+    int32_t value;          // 5.23 fixed point
+};
+
+// Cumulative safeload throughput
+struct DSPSafeloadStats {
+    uint32_t params;        // Parameter words applied
+    uint32_t triggers;      // Safeload transfers initiated
+    uint32_t busyUs;        // Time spent in dsp_safeloadParams
+    uint32_t lastParams;    // Words applied by the last call
+    uint32_t lastUs;        // Duration of the last call
+};
+
+// One DSP on the bus; groups is a bitmask used to address sets of devices
+struct DSPTarget {
+    uint8_t address;        // 7-bit I2C address
+    uint8_t groups;
+    bool present;           // Acknowledged when added
+};
+
+// Outcome of the last broadcast on one device
+struct DSPBroadcastResult {
+    uint8_t address;
+    uint16_t transfers;     // Safeload transfers (IST set) or bursts completed
+    bool ok;                // Every transfer reached the device
+};
+
+// Inter-device timing of broadcast writes
+struct DSPBroadcastStats {
+    uint32_t broadcasts;
+    uint32_t overBound;     // Broadcasts over DSP_BROADCAST_SKEW_MAX_US
+    uint32_t lastSkewUs;    // First to last device completion
+    uint32_t maxSkewUs;
+    uint8_t lastTargets;
+    DSPBroadcastResult lastResults[DSP_MAX_TARGETS];  // Also set when a broadcast fails
 };
 
 // Core DSP Functions
@@ -56,21 +164,91 @@ bool dsp_readRegister(uint16_t regAddr, uint8_t& value);
 bool dsp_writeRegisterVerified(uint16_t regAddr, uint8_t value);
 bool dsp_readMultipleRegisters(uint16_t startAddr, uint8_t* buffer, size_t count);
 
+// Burst transfers with subaddress auto-increment (program/parameter RAM, registers).
+// Memory lengths must be whole words; transfers are split into bus-buffer bursts.
+bool dsp_writeBlock(uint16_t subaddress, const uint8_t* data, size_t length);
+bool dsp_readBlock(uint16_t subaddress, uint8_t* buffer, size_t length);
+size_t dsp_memoryWordBytes(uint16_t subaddress);
+
+// Word-level memory access built on the burst calls
+bool dsp_writeParamWords(uint16_t paramAddr, const int32_t* words, size_t count);
+bool dsp_readParamWords(uint16_t paramAddr, int32_t* words, size_t count);
+bool dsp_writeProgramWords(uint16_t progAddr, const uint8_t* words, size_t count);
+bool dsp_readProgramWords(uint16_t progAddr, uint8_t* words, size_t count);
+
+// Parameter RAM shadow (values written through this module)
+bool dsp_shadowGet(uint16_t paramAddr, int32_t& value);  // false if unknown
+void dsp_shadowInvalidate();
+uint16_t dsp_shadowValidCount();
+bool dsp_shadowSync();                                   // Read back all parameter RAM
+
 // High-level DSP Control Functions
 bool dsp_setRunState(bool run);
 bool dsp_softReset();
 bool dsp_hardReset();
+// The DSP only reloads from its EEPROM (or the emulator) out of /RESET, so
+// self-boot needs the reset pin; without it dsp_selfBoot() refuses
+bool dsp_canSelfBoot();
 bool dsp_selfBoot();
 DSPStatus dsp_getStatus();
 
+// Hard reset pin (-1 = not wired, hard reset falls back to soft reset).
+// Refuses pins outside DSP_RESET_PIN_CHOICES or already in use.
+bool dsp_resetPinAllowed(int pin);
+bool dsp_setResetPin(int8_t pin);
+int8_t dsp_getResetPin();
+
+// Boot profiler - every hard reset and self-boot records a profile. Without
+// a reset pin it profiles a core restart (reloaded stays false).
+bool dsp_profileBoot();
+const DSPBootProfile& dsp_getBootProfile();
+void dsp_setBootBaseline(uint32_t totalUs);   // 0 = use the last profile
+uint32_t dsp_getBootBaseline();
+
+// Status sampler - call dsp_statusService() from loop(); handlers read the snapshot
+bool dsp_sampleStatus();
+void dsp_statusService();
+const DSPStatusSnapshot& dsp_getStatusSnapshot();
+void dsp_setStatusSampleInterval(uint32_t intervalMs);
+uint32_t dsp_getStatusSampleInterval();
+
 // Safeload Functions (for parameter RAM updates)
+// dsp_safeloadWrite stages up to five slots; dsp_safeloadTrigger transfers them.
+// Both take dsp_busLock; batches below never touch these staged slots.
 bool dsp_safeloadWrite(uint16_t paramAddr, uint8_t* data, size_t count);
 bool dsp_safeloadTrigger();
+// Batched update - splits into five-slot transfers, glitch-free per transfer
+bool dsp_safeloadParams(const DSPParamWrite* params, size_t count);
+const DSPSafeloadStats& dsp_getSafeloadStats();
+int32_t dsp_floatTo523(float value);
+
+// Multiple DSP targets - target 0 is the primary device. It belongs to every
+// group until dsp_addTarget names its address with other group bits;
+// dsp_clearTargets restores that default. Broadcast calls fan identical
+// writes out to each device whose group bits intersect groupMask, back to
+// back, and record the inter-device skew. A device that fails is dropped
+// for the rest of the call and the others carry on; lastResults says which
+// devices took every transfer.
+bool dsp_addTarget(uint8_t address, uint8_t groups);
+void dsp_clearTargets();
+uint8_t dsp_getTargetCount();
+DSPTarget dsp_getTarget(uint8_t index);
+bool dsp_broadcastBlock(uint8_t groupMask, uint16_t subaddress, const uint8_t* data, size_t length);
+bool dsp_broadcastSafeload(uint8_t groupMask, const DSPParamWrite* params, size_t count);
+const DSPBroadcastStats& dsp_getBroadcastStats();
 
 // Diagnostic Functions
 void dsp_printStatus();
 bool dsp_testCommunication();
 String dsp_getErrorString(int errorCode);
+int dsp_getLastError();
+
+// Bus lock (recursive) - hold across multi-transaction sequences that must
+// not interleave with timer callbacks or other tasks. The lock returns the
+// DSP's bus; use it (i2c_wire(bus)) for the whole sequence and pass it back.
+uint8_t dsp_busLock();
+bool dsp_busTryLock(uint32_t waitMs, uint8_t& bus);   // false: still busy after waitMs
+void dsp_busUnlock(uint8_t bus);
 
 // Legacy compatibility functions
 bool setDSPRunState(bool run);
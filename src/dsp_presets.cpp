@@ -0,0 +1,214 @@
+#include "dsp_presets.h"
+#include "dsp_helper.h"
+#include "config.h"
+#include <Preferences.h>
+
+#define DSP_PRESET_NAMESPACE "dsp_presets"
+#define DSP_PRESET_MAGIC     0x50524553  // "PRES"
+
+// Each slot is two keys: "hN" holds the header, "pN" the entry array
+struct PresetHeader {
+  uint32_t magic;
+  char name[DSP_PRESET_NAME_LEN];
+  uint16_t words;
+};
+
+struct PresetEntry {
+  uint16_t address;
+  int32_t value;
+} __attribute__((packed));
+
+static_assert(sizeof(PresetEntry) == DSP_PRESET_ENTRY_BYTES, "PresetEntry must stay packed");
+
+static void presetKeys(uint8_t slot, char* headerKey, char* dataKey) {
+  snprintf(headerKey, 8, "h%u", slot);
+  snprintf(dataKey, 8, "p%u", slot);
+}
+
+// Entry bytes stored in every slot but exceptSlot (-1 = all slots)
+static uint32_t presetBytesUsed(Preferences& prefs, int exceptSlot) {
+  uint32_t used = 0;
+  for (uint8_t slot = 0; slot < DSP_PRESET_SLOTS; slot++) {
+    char headerKey[8], dataKey[8];
+    presetKeys(slot, headerKey, dataKey);
+    if (slot != exceptSlot && prefs.isKey(dataKey)) {
+      used += prefs.getBytesLength(dataKey);
+    }
+  }
+  return used;
+}
+
+uint32_t dsp_preset_bytesUsed() {
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, true);
+  uint32_t used = presetBytesUsed(prefs, -1);
+  prefs.end();
+  return used;
+}
+
+uint16_t dsp_preset_capacity(uint8_t slot) {
+  if (slot >= DSP_PRESET_SLOTS) return 0;
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, true);
+  uint32_t used = presetBytesUsed(prefs, slot);
+  prefs.end();
+  return used < DSP_PRESET_NVS_BUDGET ? (DSP_PRESET_NVS_BUDGET - used) / sizeof(PresetEntry) : 0;
+}
+
+bool dsp_preset_save(uint8_t slot, const char* name) {
+  if (slot >= DSP_PRESET_SLOTS) return false;
+
+  uint16_t words = dsp_shadowValidCount();
+  if (words == 0) {
+    Serial.println("Preset: shadow cache is empty, nothing to save");
+    return false;
+  }
+
+  size_t dataSize = words * sizeof(PresetEntry);
+  uint16_t capacity = dsp_preset_capacity(slot);
+  if (words > capacity) {
+    Serial.printf("Preset: %u words exceed the store budget (%u words free)\n", words, capacity);
+    return false;
+  }
+  if (ESP.getFreeHeap() < dataSize + MIN_SAFE_HEAP) {
+    Serial.println("Preset: insufficient memory");
+    return false;
+  }
+
+  PresetEntry* entries = (PresetEntry*)malloc(dataSize);
+  if (!entries) return false;
+
+  uint16_t n = 0;
+  for (uint16_t addr = 0; addr < ADAU1701_PARAM_RAM_WORDS && n < words; addr++) {
+    int32_t value;
+    if (dsp_shadowGet(addr, value)) {
+      entries[n].address = addr;
+      entries[n].value = value;
+      n++;
+    }
+  }
+
+  PresetHeader header;
+  header.magic = DSP_PRESET_MAGIC;
+  strlcpy(header.name, name ? name : "", sizeof(header.name));
+  header.words = n;
+
+  char headerKey[8], dataKey[8];
+  presetKeys(slot, headerKey, dataKey);
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, false);
+  // The new blob is written before the old one is erased: it needs a
+  // 32-byte entry per 32 data bytes plus index and header entries
+  if (prefs.freeEntries() < dataSize / 32 + 6) {
+    Serial.printf("Preset: NVS full (%u entries free)\n", (unsigned)prefs.freeEntries());
+    prefs.end();
+    free(entries);
+    return false;
+  }
+  bool ok = prefs.putBytes(dataKey, entries, dataSize) == dataSize &&
+            prefs.putBytes(headerKey, &header, sizeof(header)) == sizeof(header);
+  if (!ok) {
+    prefs.remove(headerKey);
+    prefs.remove(dataKey);
+  }
+  prefs.end();
+  free(entries);
+
+  Serial.printf("Preset %u '%s': %s (%u words)\n", slot, header.name, ok ? "saved" : "save failed", n);
+  return ok;
+}
+
+bool dsp_preset_recall(uint8_t slot, DSPPresetRecallStats& stats) {
+  memset(&stats, 0, sizeof(stats));
+  if (slot >= DSP_PRESET_SLOTS) return false;
+
+  unsigned long startTime = micros();
+  char headerKey[8], dataKey[8];
+  presetKeys(slot, headerKey, dataKey);
+
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, true);
+  PresetHeader header;
+  size_t dataSize = prefs.getBytesLength(dataKey);
+  if (prefs.getBytes(headerKey, &header, sizeof(header)) != sizeof(header) ||
+      header.magic != DSP_PRESET_MAGIC || dataSize != header.words * sizeof(PresetEntry) ||
+      ESP.getFreeHeap() < dataSize + MIN_SAFE_HEAP) {
+    prefs.end();
+    return false;
+  }
+
+  PresetEntry* entries = (PresetEntry*)malloc(dataSize);
+  if (!entries || prefs.getBytes(dataKey, entries, dataSize) != dataSize) {
+    free(entries);
+    prefs.end();
+    return false;
+  }
+  prefs.end();
+
+  // Collect differing words and send them in full safeload batches
+  DSPParamWrite batch[ADAU1701_SAFELOAD_SLOTS * 8];
+  size_t pending = 0;
+  bool ok = true;
+  stats.words = header.words;
+
+  for (uint16_t i = 0; i < header.words && ok; i++) {
+    int32_t current;
+    if (dsp_shadowGet(entries[i].address, current) && current == entries[i].value) {
+      continue;
+    }
+    batch[pending].address = entries[i].address;
+    batch[pending].value = entries[i].value;
+    pending++;
+    stats.changed++;
+
+    if (pending == sizeof(batch) / sizeof(batch[0])) {
+      ok = dsp_safeloadParams(batch, pending);
+      stats.transfers += (pending + ADAU1701_SAFELOAD_SLOTS - 1) / ADAU1701_SAFELOAD_SLOTS;
+      pending = 0;
+    }
+  }
+  if (ok && pending > 0) {
+    ok = dsp_safeloadParams(batch, pending);
+    stats.transfers += (pending + ADAU1701_SAFELOAD_SLOTS - 1) / ADAU1701_SAFELOAD_SLOTS;
+  }
+
+  free(entries);
+  stats.elapsedUs = micros() - startTime;
+  Serial.printf("Preset %u recalled: %u/%u words changed, %u transfers (%lu us)\n",
+                slot, stats.changed, stats.words, stats.transfers, (unsigned long)stats.elapsedUs);
+  return ok;
+}
+
+bool dsp_preset_info(uint8_t slot, DSPPresetInfo& info) {
+  memset(&info, 0, sizeof(info));
+  if (slot >= DSP_PRESET_SLOTS) return false;
+
+  char headerKey[8], dataKey[8];
+  presetKeys(slot, headerKey, dataKey);
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, true);
+
+  PresetHeader header;
+  if (prefs.isKey(headerKey) &&
+      prefs.getBytes(headerKey, &header, sizeof(header)) == sizeof(header) &&
+      header.magic == DSP_PRESET_MAGIC) {
+    info.used = true;
+    strlcpy(info.name, header.name, sizeof(info.name));
+    info.words = header.words;
+  }
+  prefs.end();
+  return info.used;
+}
+
+bool dsp_preset_delete(uint8_t slot) {
+  if (slot >= DSP_PRESET_SLOTS) return false;
+
+  char headerKey[8], dataKey[8];
+  presetKeys(slot, headerKey, dataKey);
+  Preferences prefs;
+  prefs.begin(DSP_PRESET_NAMESPACE, false);
+  bool ok = prefs.remove(headerKey);
+  prefs.remove(dataKey);
+  prefs.end();
+  return ok;
+}
@@ -0,0 +1,42 @@
+#ifndef DSP_PRESETS_H
+#define DSP_PRESETS_H
+
+#include <Arduino.h>
+
+// Presets are stored in NVS (Preferences) as sparse address/value lists.
+// The default nvs partition is 20KB, shared with WiFi and the parameter
+// map, so all slots together get a fixed byte budget: one full parameter
+// RAM preset (6KB) or several sparse ones.
+#define DSP_PRESET_SLOTS       8
+#define DSP_PRESET_NAME_LEN    24
+#define DSP_PRESET_NVS_BUDGET  8192      // Entry bytes across all slots
+#define DSP_PRESET_ENTRY_BYTES 6         // Address + value
+
+struct DSPPresetInfo {
+  bool used;
+  char name[DSP_PRESET_NAME_LEN];
+  uint16_t words;
+};
+
+struct DSPPresetRecallStats {
+  uint16_t words;           // Words stored in the preset
+  uint16_t changed;         // Words that differed from the shadow and were written
+  uint16_t transfers;       // Safeload transfers issued
+  uint32_t elapsedUs;
+};
+
+// Save every parameter word currently known to the shadow cache
+bool dsp_preset_save(uint8_t slot, const char* name);
+
+// Safeload only the words that differ from the shadow cache
+bool dsp_preset_recall(uint8_t slot, DSPPresetRecallStats& stats);
+
+bool dsp_preset_info(uint8_t slot, DSPPresetInfo& info);
+bool dsp_preset_delete(uint8_t slot);
+
+// Budget use, and the words a save into slot could hold (its own old
+// entries are replaced, so they count as free)
+uint32_t dsp_preset_bytesUsed();
+uint16_t dsp_preset_capacity(uint8_t slot);
+
+#endif // DSP_PRESETS_H
@@ -3,8 +3,18 @@
 #include "config.h"
 #include <ArduinoJson.h>
 #include <WebServer.h>
-#include <Wire.h>
+#include "i2c_bus.h"
 #include "eeprom_manager.h"
+#include "param_queue.h"
+#include "biquad_designer.h"
+#include "dsp_presets.h"
+#include "param_map.h"
+#include "level_stream.h"
+#include "dsp_snapshot.h"
+#include "sigma_tcp.h"
+#include "param_sequencer.h"
+#include "dsp_script.h"
+#include "dsp_boot_verify.h"
 
 // Global server reference (shared with other modules)
 extern WebServer *g_server;
@@ -108,14 +118,82 @@ void handleDSPSoftReset() {
   sendJson(200, doc);
 }
 
+static void addBootProfile(JsonDocument& doc) {
+  const DSPBootProfile& p = dsp_getBootProfile();
+  JsonObject o = doc["boot"].to<JsonObject>();
+  o["hard_reset"] = p.hardReset;
+  o["complete"] = p.complete;
+  o["reloaded"] = p.reloaded;
+  o["first_ack_us"] = p.firstAckUs;
+  o["core_running_us"] = p.coreRunningUs;
+  o["core_control"] = p.coreControl;
+  o["total_us"] = p.totalUs;
+  o["polls"] = p.polls;
+  o["busy_polls"] = p.busyPolls;
+  o["baseline_us"] = dsp_getBootBaseline();
+  o["regression"] = p.regression;
+}
+
+static void addBootVerify(JsonDocument& doc, const DSPBootVerifyResult& result) {
+  JsonObject o = doc["verify"].to<JsonObject>();
+  o["ok"] = result.ok;
+  o["image_valid"] = result.imageValid;
+  o["checked"] = result.checked;
+  o["mismatches"] = result.mismatches;
+  o["bytes_compared"] = result.bytesCompared;
+  o["duration_ms"] = result.durationMs;
+  if (result.error) {
+    o["error"] = result.error;
+  }
+
+  uint8_t count;
+  const DSPBootVerifyRegion* regions = dsp_boot_verify_getRegions(count);
+  JsonArray list = o["regions"].to<JsonArray>();
+  char hash[9];
+  for (uint8_t i = 0; i < count; i++) {
+    JsonObject r = list.add<JsonObject>();
+    r["addr"] = regions[i].subaddress;
+    r["length"] = regions[i].length;
+    r["checked"] = regions[i].checked;
+    if (!regions[i].checked) continue;
+    r["match"] = regions[i].match;
+    snprintf(hash, sizeof(hash), "%08lX", (unsigned long)regions[i].imageHash);
+    r["image_hash"] = hash;
+    snprintf(hash, sizeof(hash), "%08lX", (unsigned long)regions[i].dspHash);
+    r["dsp_hash"] = hash;
+    if (regions[i].firstMismatch >= 0) {
+      r["first_mismatch"] = regions[i].firstMismatch;
+    }
+  }
+}
+
+// Self-boot; ?verify=1 also compares DSP RAM against the EEPROM image
 void handleDSPSelfBoot() {
   Serial.println("DSP self-boot trigger");
 
   JsonDocument doc;
+  if (!dsp_canSelfBoot()) {
+    doc["success"] = false;
+    doc["message"] = "No reset pin configured - the DSP only self-boots from /RESET";
+    sendJson(400, doc);
+    return;
+  }
 
   // Self-boot sequence using DSP helper
   bool success = dsp_selfBoot();
 
+  doc["success"] = success;
+  doc["message"] = success ? "DSP self-boot completed" : "Self-boot failed";
+  addBootProfile(doc);
+  if (success && g_server->hasArg("verify")) {
+    DSPBootVerifyResult result = dsp_boot_verify_run();
+    addBootVerify(doc, result);
+    doc["success"] = result.ok;
+    if (!result.ok) {
+      doc["message"] = "DSP RAM does not match the EEPROM image";
+    }
+  }
+
   sendJson(200, doc);
 }
 
@@ -152,32 +230,57 @@ void handleDSPI2CDebug() {
   sendJson(200, doc);
 }
 
-void handleDSPStatus() {
-  Serial.println("DSP status read");
+static void addSnapshotAge(JsonDocument& doc, const DSPStatusSnapshot& snap) {
+  doc["age_ms"] = millis() - snap.sampledMs;
+  doc["sample_us"] = snap.sampleUs;
+  doc["sample_interval_ms"] = dsp_getStatusSampleInterval();
+}
 
+// Served from the sampler snapshot; ?refresh=1 samples first
+void handleDSPStatus() {
   JsonDocument doc;
 
-  // Get comprehensive status using DSP helper
-  DSPStatus status = dsp_getStatus();
+  if (g_server->hasArg("refresh") || dsp_getStatusSnapshot().samples == 0) {
+    dsp_sampleStatus();
+  }
+  const DSPStatusSnapshot& snap = dsp_getStatusSnapshot();
+  const DSPStatus& status = snap.status;
 
   doc["success"] = status.detected;
   if (status.detected) {
-    doc["dck_stable"] = status.dckStable;
-    doc["pll_locked"] = status.pllLocked;
-    doc["safeload_ready"] = status.safeloadReady;
     doc["core_running"] = status.coreRunning;
-    doc["hardware_id"] = status.hardwareId;
-    doc["hardware_valid"] = (status.hardwareId == 0x02);
-    doc["software_id"] = status.softwareId;
-    doc["control_register"] = status.controlReg;
-    doc["status_register"] = status.statusReg;
+    doc["safeload_pending"] = status.safeloadPending;
+    doc["core_control"] = status.coreControl;
   } else {
     doc["message"] = "DSP not responding";
   }
+  addSnapshotAge(doc, snap);
 
   sendJson(200, doc);
 }
 
+// Sampler interval: {"interval_ms":500} (0 disables background sampling)
+void handleDSPStatusSampler() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain")) ||
+      !req["interval_ms"].is<uint32_t>()) {
+    doc["success"] = false;
+    doc["message"] = "interval_ms required";
+    sendJson(400, doc);
+    return;
+  }
+
+  dsp_setStatusSampleInterval(req["interval_ms"].as<uint32_t>());
+  const DSPStatusSnapshot& snap = dsp_getStatusSnapshot();
+  doc["success"] = true;
+  doc["samples"] = snap.samples;
+  doc["failures"] = snap.failures;
+  addSnapshotAge(doc, snap);
+  sendJson(200, doc);
+}
+
+// Reports from the snapshot; ?write_test=1 adds the active write/readback test
 void handleDSPDiagnostic() {
   Serial.println("DSP comprehensive diagnostic");
 
@@ -185,11 +288,17 @@ void handleDSPDiagnostic() {
   doc["i2c_address"] = DSP_I2C_ADDRESS;
   doc["free_heap_start"] = ESP.getFreeHeap();
 
-  // Test 1: Basic I2C communication using DSP helper
-  bool detected = dsp_detect();
-  doc["basic_detection"] = detected;
-
-  if (!detected) {
+  if (dsp_getStatusSnapshot().samples == 0) {
+    dsp_sampleStatus();
+  }
+  const DSPStatusSnapshot& snap = dsp_getStatusSnapshot();
+  const DSPStatus& status = snap.status;
+  doc["basic_detection"] = status.detected;
+  doc["samples"] = snap.samples;
+  doc["sample_failures"] = snap.failures;
+  addSnapshotAge(doc, snap);
+
+  if (!status.detected) {
     doc["success"] = false;
     doc["message"] = "DSP not responding to basic I2C detection";
     doc["free_heap_end"] = ESP.getFreeHeap();
@@ -197,19 +306,16 @@ void handleDSPDiagnostic() {
     return;
   }
 
-  // Test 2: Read hardware ID using DSP helper
-  DSPStatus status = dsp_getStatus();
-  doc["hardware_id"] = status.hardwareId;
-  doc["hardware_valid"] = (status.hardwareId == 0x02);
+  doc["core_control"] = status.coreControl;
+  doc["core_running"] = status.coreRunning;
 
-  // Test 3: Test communication using DSP helper
-  bool comm_test = dsp_testCommunication();
-  doc["write_test"] = comm_test;
-
-  // Test 4: Get control register value
-  doc["control_readback"] = status.controlReg;
+  bool comm_test = true;
+  if (g_server->hasArg("write_test")) {
+    comm_test = dsp_testCommunication();
+    doc["write_test"] = comm_test;
+  }
 
-  doc["success"] = status.detected && (status.hardwareId == 0x02) && comm_test;
+  doc["success"] = comm_test;
   doc["message"] = doc["success"] ?
     "DSP communication established" :
     "DSP detected but communication issues";
@@ -235,24 +341,29 @@ void handleDSPResetTest() {
   uint8_t working_addr = 0;
 
   for (int i = 0; i < 4; i++) {
-    Wire.beginTransmission(possible_addresses[i]);
-    int result = Wire.endTransmission();
+    uint8_t bus = dsp_busLock();
+    TwoWire& wire = i2c_wire(bus);
+    wire.beginTransmission(possible_addresses[i]);
+    int result = wire.endTransmission();
     if (result == 0) {
       // Test hardware ID
-      Wire.beginTransmission(possible_addresses[i]);
-      Wire.write(0xF0); Wire.write(0x02);
-      if (Wire.endTransmission(false) == 0) {
+      wire.beginTransmission(possible_addresses[i]);
+      wire.write(0xF0); wire.write(0x02);
+      if (wire.endTransmission(false) == 0) {
         // Use explicitly sized parameter to avoid ambiguity
-        if (Wire.requestFrom((uint8_t)possible_addresses[i], (uint8_t)1) == 1) {
-          uint8_t hw_id = Wire.read();
+        if (wire.requestFrom((uint8_t)possible_addresses[i], (uint8_t)1) == 1) {
+          uint8_t hw_id = wire.read();
           if (hw_id == 0x02) {
             found = true;
             working_addr = possible_addresses[i];
-            break;
           }
         }
       }
     }
+    dsp_busUnlock(bus);
+    if (found) {
+      break;
+    }
     yield();
   }
 
@@ -265,69 +376,1018 @@ void handleDSPResetTest() {
   sendJson(200, doc);
 }
 
+// Core control from the sampler snapshot; ?refresh=1 samples first
 void handleDSPRegisters() {
-  Serial.println("DSP register read - memory optimized");
+  if (g_server->hasArg("refresh") || dsp_getStatusSnapshot().samples == 0) {
+    dsp_sampleStatus();
+  }
+  const DSPStatusSnapshot& snap = dsp_getStatusSnapshot();
 
-  // Check memory before starting
-  if (ESP.getFreeHeap() < 3000) {
-    JsonDocument doc;
+  JsonDocument doc;
+  char regName[8];
+  snprintf(regName, sizeof(regName), "0x%04X", ADAU1701_CORE_CONTROL_REG);
+  doc["registers"][regName] = snap.status.detected ? snap.status.coreControl : 0xFFFF;
+
+  doc["success"] = snap.status.detected;
+  doc["message"] = snap.status.detected ? "Registers read successfully" : "Failed to read all registers";
+  addSnapshotAge(doc, snap);
+
+  sendJson(200, doc);
+}
+
+// Dump parameter or program RAM words: /dsp/memory?addr=0x0000&count=16
+void handleDSPMemory() {
+  const uint16_t MAX_WORDS = 64;
+
+  uint16_t addr = g_server->hasArg("addr") ? (uint16_t)strtoul(g_server->arg("addr").c_str(), nullptr, 0) : 0;
+  uint16_t count = g_server->hasArg("count") ? (uint16_t)g_server->arg("count").toInt() : 16;
+  size_t wordBytes = dsp_memoryWordBytes(addr);
+
+  JsonDocument doc;
+  if (wordBytes == 0 || count == 0 || count > MAX_WORDS) {
     doc["success"] = false;
-    doc["message"] = "Insufficient memory for register read";
+    doc["message"] = "addr must be in parameter/program RAM, count 1-64";
+    sendJson(400, doc);
+    return;
+  }
+
+  uint8_t buf[MAX_WORDS * ADAU1701_PROG_WORD_BYTES];
+  unsigned long readStart = micros();
+  bool ok = (wordBytes == ADAU1701_PARAM_WORD_BYTES)
+              ? (addr + count <= ADAU1701_PROG_RAM_START && dsp_readBlock(addr, buf, count * wordBytes))
+              : dsp_readProgramWords(addr, buf, count);
+  unsigned long readUs = micros() - readStart;
+
+  doc["success"] = ok;
+  doc["addr"] = addr;
+  doc["wordBytes"] = wordBytes;
+  doc["readUs"] = readUs;
+  if (!ok) {
+    doc["message"] = dsp_getErrorString(dsp_getLastError());
     sendJson(500, doc);
     return;
   }
 
+  JsonArray words = doc["words"].to<JsonArray>();
+  char hex[ADAU1701_PROG_WORD_BYTES * 2 + 1];
+  for (uint16_t w = 0; w < count; w++) {
+    for (size_t b = 0; b < wordBytes; b++) {
+      snprintf(hex + b * 2, 3, "%02X", buf[w * wordBytes + b]);
+    }
+    words.add(hex);
+  }
+  sendJson(200, doc);
+}
+
+// Parameter address from "addr" or a SigmaStudio "name" (0xFFFF if unknown)
+static uint16_t resolveParamAddress(JsonObject p) {
+  const char* name = p["name"];
+  if (name) {
+    uint16_t addr;
+    return param_map_lookup(name, addr) ? addr : 0xFFFF;
+  }
+  return p["addr"] | 0xFFFF;
+}
+
+// Fill params from [{"addr"|"name", "value"|"raw"}, ...]
+static size_t parseParamList(JsonArray list, DSPParamWrite* params) {
+  size_t count = 0;
+  for (JsonObject p : list) {
+    params[count].address = resolveParamAddress(p);
+    params[count].value = p["raw"].is<int32_t>() ? p["raw"].as<int32_t>()
+                                                 : dsp_floatTo523(p["value"] | 0.0f);
+    count++;
+  }
+  return count;
+}
+
+// Batched parameter update:
+// {"params":[{"addr":12,"value":0.5}, {"name":"MOD_VOL_ALG0_TARGET","raw":8388608}, ...]}
+void handleDSPSafeload() {
+  const size_t MAX_PARAMS = 64;
+
+  JsonDocument doc;
+  if (!g_server->hasArg("plain")) {
+    doc["success"] = false;
+    doc["message"] = "No data provided";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonDocument req;
+  if (deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonArray list = req["params"].as<JsonArray>();
+  if (list.isNull() || list.size() == 0 || list.size() > MAX_PARAMS) {
+    doc["success"] = false;
+    doc["message"] = "params must hold 1-64 entries";
+    sendJson(400, doc);
+    return;
+  }
+
+  DSPParamWrite params[MAX_PARAMS];
+  size_t count = parseParamList(list, params);
+
+  bool ok = dsp_safeloadParams(params, count);
+  const DSPSafeloadStats& stats = dsp_getSafeloadStats();
+
+  doc["success"] = ok;
+  doc["params"] = stats.lastParams;
+  doc["transfers"] = (stats.lastParams + ADAU1701_SAFELOAD_SLOTS - 1) / ADAU1701_SAFELOAD_SLOTS;
+  doc["i2cUs"] = stats.lastUs;
+  doc["paramsPerSec"] = stats.lastUs ? stats.lastParams * 1000000.0f / stats.lastUs : 0.0f;
+  doc["totalParams"] = stats.params;
+  doc["avgParamsPerSec"] = stats.busyUs ? stats.params * 1000000.0f / stats.busyUs : 0.0f;
+  if (!ok) {
+    doc["message"] = dsp_getErrorString(dsp_getLastError());
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+static void addParamQueueStats(JsonDocument& doc) {
+  const ParamQueueStats& stats = param_queue_getStats();
+  doc["pending"] = stats.pending;
+  doc["received"] = stats.received;
+  doc["coalesced"] = stats.coalesced;
+  doc["rejected"] = stats.rejected;
+  doc["applied"] = stats.applied;
+  doc["transfers"] = stats.transfers;
+  doc["failures"] = stats.failures;
+  doc["lastLatencyMs"] = stats.lastLatencyMs;
+  doc["maxLatencyMs"] = stats.maxLatencyMs;
+}
+
+static bool pushQueuedParam(JsonObject p) {
+  int32_t value = p["raw"].is<int32_t>() ? p["raw"].as<int32_t>() : dsp_floatTo523(p["value"] | 0.0f);
+  return param_queue_push(resolveParamAddress(p), value);
+}
+
+// Queued (latest-wins) parameter update for sliders - returns immediately:
+// {"addr":12,"value":0.5} or {"params":[{"addr":12,"raw":8388608}, ...]}
+void handleDSPParamQueue() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  uint16_t total = 0;
+  uint16_t queued = 0;
+  JsonArray list = req["params"].as<JsonArray>();
+  if (list.isNull()) {
+    total = 1;
+    queued = pushQueuedParam(req.as<JsonObject>()) ? 1 : 0;
+  } else {
+    for (JsonObject p : list) {
+      total++;
+      queued += pushQueuedParam(p) ? 1 : 0;
+    }
+  }
+
+  doc["success"] = queued == total;
+  doc["queued"] = queued;
+  addParamQueueStats(doc);
+  sendJson(200, doc);
+}
+
+void handleDSPParamQueueStats() {
+  JsonDocument doc;
+  doc["success"] = true;
+  addParamQueueStats(doc);
+  sendJson(200, doc);
+}
+
+// Design and apply an EQ curve in one request:
+// {"sampleRate":48000,"apply":true,
+//  "bands":[{"addr":20,"type":"peaking","f0":1000,"q":1.41,"gain":3}, ...]}
+// Each band's five words go out in one safeload transfer, so every biquad
+// switches atomically between audio frames.
+void handleDSPEqDesign() {
   JsonDocument doc;
-  bool anySuccess = false;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
 
-  // Read key DSP registers with better error handling
-  const int NUM_REGS = 5;
-  uint16_t regs[NUM_REGS] = {0xF000, 0xF001, 0xF002, 0xF003, 0xF004};
+  JsonArray bands = req["bands"].as<JsonArray>();
+  if (bands.isNull() || bands.size() == 0 || bands.size() > BIQUAD_MAX_BANDS) {
+    doc["success"] = false;
+    doc["message"] = "bands must hold 1-16 entries";
+    sendJson(400, doc);
+    return;
+  }
 
-  for (int i = 0; i < NUM_REGS; i++) {
-    // Use small local buffers to avoid memory fragmentation
-    uint8_t regValue = 0xFF; // Default to 0xFF if read fails
+  BiquadSpec specs[BIQUAD_MAX_BANDS];
+  size_t count = 0;
+  for (JsonObject b : bands) {
+    specs[count].type = biquad_parseType(b["type"] | "peaking");
+    specs[count].f0 = b["f0"] | 0.0f;
+    specs[count].q = b["q"] | 0.7071f;
+    specs[count].gainDb = b["gain"] | 0.0f;
+    specs[count].paramAddr = resolveParamAddress(b);
+    count++;
+  }
 
-    Wire.beginTransmission(DSP_I2C_ADDRESS);
-    Wire.write((uint8_t)(regs[i] >> 8));   // High byte
-    Wire.write((uint8_t)(regs[i] & 0xFF)); // Low byte
-    int txResult = Wire.endTransmission(false);
+  float sampleRate = req["sampleRate"] | (float)DSP_SAMPLE_RATE;
+  bool apply = req["apply"] | true;
 
-    if (txResult == 0) {
-      uint8_t bytesRead = Wire.requestFrom((uint8_t)DSP_I2C_ADDRESS, (uint8_t)1);
-      if (bytesRead == 1 && Wire.available()) {
-        regValue = Wire.read();
-        anySuccess = true;
+  DSPParamWrite params[BIQUAD_MAX_BANDS * BIQUAD_PARAM_WORDS];
+  size_t badBand = 0;
+  unsigned long computeStart = micros();
+  bool designed = biquad_designBands(specs, count, sampleRate, params, &badBand);
+  unsigned long computeUs = micros() - computeStart;
 
-        // Log successful read for debugging
-        Serial.printf("REG 0x%04X: 0x%02X\n", regs[i], regValue);
+  if (!designed) {
+    doc["success"] = false;
+    doc["message"] = "Invalid band specification";
+    doc["band"] = badBand;
+    sendJson(400, doc);
+    return;
+  }
+
+  size_t words = count * BIQUAD_PARAM_WORDS;
+  doc["bands"] = count;
+  doc["params"] = words;
+  doc["computeUs"] = computeUs;
+
+  if (!apply) {
+    JsonArray coeffs = doc["coefficients"].to<JsonArray>();
+    for (size_t i = 0; i < words; i++) {
+      coeffs.add(params[i].value);
+    }
+    doc["success"] = true;
+    sendJson(200, doc);
+    return;
+  }
+
+  bool ok = dsp_safeloadParams(params, words);
+  const DSPSafeloadStats& stats = dsp_getSafeloadStats();
+  doc["success"] = ok;
+  doc["transfers"] = count;
+  doc["i2cUs"] = stats.lastUs;
+  if (!ok) {
+    doc["message"] = dsp_getErrorString(dsp_getLastError());
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// Preset store: GET lists slots; POST {"action":"save|recall|delete","slot":0,"name":"..."}
+// "sync":true on save reads parameter RAM back first, so values loaded by
+// self-boot are captured as well as those written through this server.
+void handleDSPPresetList() {
+  JsonDocument doc;
+  JsonArray slots = doc["presets"].to<JsonArray>();
+  for (uint8_t slot = 0; slot < DSP_PRESET_SLOTS; slot++) {
+    DSPPresetInfo info;
+    JsonObject entry = slots.add<JsonObject>();
+    entry["slot"] = slot;
+    entry["used"] = dsp_preset_info(slot, info);
+    if (info.used) {
+      entry["name"] = info.name;
+      entry["words"] = info.words;
+    }
+  }
+  doc["shadowWords"] = dsp_shadowValidCount();
+  doc["storeBytes"] = dsp_preset_bytesUsed();
+  doc["storeBudget"] = DSP_PRESET_NVS_BUDGET;
+  doc["success"] = true;
+  sendJson(200, doc);
+}
+
+void handleDSPPreset() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  const char* action = req["action"] | "";
+  uint8_t slot = req["slot"] | 0xFF;
+  if (slot >= DSP_PRESET_SLOTS) {
+    doc["success"] = false;
+    doc["message"] = "Invalid preset slot";
+    sendJson(400, doc);
+    return;
+  }
+  doc["slot"] = slot;
+
+  if (strcmp(action, "save") == 0) {
+    bool synced = !(req["sync"] | false) || dsp_shadowSync();
+    uint16_t capacity = dsp_preset_capacity(slot);
+    doc["success"] = synced && dsp_preset_save(slot, req["name"] | "");
+    doc["words"] = dsp_shadowValidCount();
+    doc["capacity"] = capacity;
+    if (!doc["success"].as<bool>()) {
+      doc["message"] = !synced ? "Parameter RAM read failed" :
+                       dsp_shadowValidCount() > capacity ? "Preset store full" : "Preset save failed";
+    }
+  } else if (strcmp(action, "recall") == 0) {
+    DSPPresetRecallStats stats;
+    doc["success"] = dsp_preset_recall(slot, stats);
+    doc["words"] = stats.words;
+    doc["changed"] = stats.changed;
+    doc["transfers"] = stats.transfers;
+    doc["elapsedUs"] = stats.elapsedUs;
+    if (!doc["success"].as<bool>()) {
+      doc["message"] = stats.words ? dsp_getErrorString(dsp_getLastError()) : "Preset not found";
+    }
+  } else if (strcmp(action, "delete") == 0) {
+    doc["success"] = dsp_preset_delete(slot);
+  } else {
+    doc["success"] = false;
+    doc["message"] = "Unknown action";
+    sendJson(400, doc);
+    return;
+  }
+
+  sendJson(doc["success"].as<bool>() ? 200 : 500, doc);
+}
+
+// Import a SigmaStudio parameter header (*_IC_1_PARAM.h) as the name map
+void handleDSPParamMapUpload() {
+  HTTPUpload& upload = g_server->upload();
+
+  switch (upload.status) {
+    case UPLOAD_FILE_START:
+      Serial.printf("Param map import: %s\n", upload.filename.c_str());
+      param_map_beginImport();
+      break;
+    case UPLOAD_FILE_WRITE:
+      param_map_processChunk((const char*)upload.buf, upload.currentSize);
+      break;
+    case UPLOAD_FILE_END:
+      param_map_endImport();
+      break;
+    case UPLOAD_FILE_ABORTED:
+      Serial.println("Param map import aborted, reloading stored map");
+      param_map_load();
+      break;
+  }
+}
+
+void handleDSPParamMapComplete() {
+  const ParamMapImportStats& stats = param_map_getImportStats();
+  JsonDocument doc;
+  doc["success"] = stats.entries > 0;
+  doc["entries"] = stats.entries;
+  doc["collisions"] = stats.collisions;
+  doc["skipped"] = stats.skipped;
+  doc["lines"] = stats.lines;
+  if (stats.entries == 0) {
+    doc["message"] = "No parameter _ADDR defines found";
+  }
+  sendJson(stats.entries > 0 ? 200 : 400, doc);
+}
+
+// Resolve a name: /dsp/param_map?name=MOD_VOL_ALG0_TARGET
+void handleDSPParamMapLookup() {
+  JsonDocument doc;
+  doc["entries"] = param_map_count();
+
+  if (g_server->hasArg("name")) {
+    uint16_t addr;
+    bool found = param_map_lookup(g_server->arg("name").c_str(), addr);
+    doc["success"] = found;
+    if (found) {
+      doc["addr"] = addr;
+    } else {
+      doc["message"] = "Unknown parameter name";
+    }
+    sendJson(found ? 200 : 404, doc);
+    return;
+  }
+
+  doc["success"] = true;
+  sendJson(200, doc);
+}
+
+static void addLevelStreamStats(JsonDocument& doc) {
+  LevelStreamStats stats = level_stream_getStats();
+  doc["words"] = stats.words;
+  doc["rate_hz"] = stats.rateHz;
+  doc["clients"] = stats.clients;
+  doc["frames"] = stats.frames;
+  doc["sustained_hz"] = stats.sustainedHz;
+  doc["avg_jitter_us"] = stats.avgJitterUs;
+  doc["max_jitter_us"] = stats.maxJitterUs;
+  doc["read_us"] = stats.lastReadUs;
+  doc["read_failures"] = stats.readFailures;
+  doc["dropped_clients"] = stats.droppedClients;
+}
+
+// Configure readback points: {"captures":[422,690],"rate":50}. Each
+// capture is the select word of a SigmaStudio readback cell (program step
+// << 2 | register: 0 mult X, 1 mult Y, 2 MAC out, 3 accumulator)
+void handleDSPLevelsConfig() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  uint16_t captures[LEVEL_STREAM_MAX_WORDS];
+  size_t count = 0;
+  for (JsonVariant v : req["captures"].as<JsonArray>()) {
+    if (count < LEVEL_STREAM_MAX_WORDS) captures[count] = v.is<uint16_t>() ? v.as<uint16_t>() : 0xFFFF;
+    count++;
+  }
+
+  if (count > LEVEL_STREAM_MAX_WORDS ||
+      !level_stream_configure(captures, count, req["rate"] | LEVEL_STREAM_DEFAULT_HZ)) {
+    doc["success"] = false;
+    doc["message"] = "1-16 capture selects (0-0xFFF), rate 1-100 Hz";
+    sendJson(400, doc);
+    return;
+  }
+
+  doc["success"] = true;
+  addLevelStreamStats(doc);
+  sendJson(200, doc);
+}
+
+void handleDSPLevelsStats() {
+  JsonDocument doc;
+  doc["success"] = true;
+  addLevelStreamStats(doc);
+  sendJson(200, doc);
+}
+
+// Long-lived binary stream of level frames (see level_stream.h)
+void handleDSPLevelsStream() {
+  if (!level_stream_addClient(g_server->client())) {
+    JsonDocument doc;
+    doc["success"] = false;
+    doc["message"] = "Too many stream clients";
+    sendJson(503, doc);
+  }
+}
+
+static void sendSnapshotChunk(const uint8_t* data, size_t length) {
+  g_server->sendContent((const char*)data, length);
+}
+
+// Full memory snapshot as a binary blob (see dsp_snapshot.h)
+void handleDSPSnapshot() {
+  g_server->sendHeader("Content-Disposition", "attachment; filename=dsp_snapshot.bin");
+  g_server->setContentLength(dsp_snapshot_size());
+  g_server->send(200, "application/octet-stream", "");
+  dsp_snapshot_capture(sendSnapshotChunk, nullptr);
+}
+
+// Restore/diff uploads. Diff compares with the running DSP, or with
+// ?mode=blob the second uploaded file with the first.
+static uint8_t* g_snapshot_reference = nullptr;
+static size_t g_snapshot_reference_len = 0;
+static uint8_t g_snapshot_file_index = 0;
+static bool g_snapshot_reference_failed = false;
+
+static void snapshotUpload(DSPSnapshotMode mode) {
+  HTTPUpload& upload = g_server->upload();
+  bool blobMode = (mode != DSP_SNAPSHOT_RESTORE) && g_server->arg("mode") == "blob";
+  bool bufferingReference = blobMode && g_snapshot_file_index == 1;
+  // Without a reference there is nothing to diff against; later files are
+  // drained unread and the completion handler reports the memory failure
+  bool streaming = !bufferingReference && !(blobMode && g_snapshot_reference_failed);
+
+  switch (upload.status) {
+    case UPLOAD_FILE_START:
+      g_snapshot_file_index++;
+      if (blobMode && g_snapshot_file_index == 1) {
+        size_t size = dsp_snapshot_size();
+        g_snapshot_reference_failed = ESP.getFreeHeap() < size + MIN_SAFE_HEAP;
+        g_snapshot_reference = g_snapshot_reference_failed ? nullptr : (uint8_t*)malloc(size);
+        g_snapshot_reference_failed = g_snapshot_reference == nullptr;
+        g_snapshot_reference_len = 0;
+      } else if (!(blobMode && g_snapshot_reference_failed)) {
+        dsp_snapshot_begin(blobMode ? DSP_SNAPSHOT_DIFF_BLOB : mode, g_snapshot_reference);
+      }
+      break;
+    case UPLOAD_FILE_WRITE:
+      if (bufferingReference) {
+        size_t n = min(upload.currentSize, dsp_snapshot_size() - g_snapshot_reference_len);
+        if (g_snapshot_reference) {
+          memcpy(g_snapshot_reference + g_snapshot_reference_len, upload.buf, n);
+        }
+        g_snapshot_reference_len += n;
+      } else if (streaming) {
+        dsp_snapshot_feed(upload.buf, upload.currentSize);
+      }
+      break;
+    case UPLOAD_FILE_END:
+      break;
+    case UPLOAD_FILE_ABORTED:
+      // No completion handler follows - reset for the next request
+      if (streaming && g_snapshot_file_index > 0) {
+        dsp_snapshot_abort();
+      }
+      free(g_snapshot_reference);
+      g_snapshot_reference = nullptr;
+      g_snapshot_reference_len = 0;
+      g_snapshot_file_index = 0;
+      break;
+  }
+}
+
+void handleDSPSnapshotRestoreUpload() {
+  snapshotUpload(DSP_SNAPSHOT_RESTORE);
+}
+
+void handleDSPSnapshotDiffUpload() {
+  snapshotUpload(DSP_SNAPSHOT_DIFF_LIVE);
+}
+
+static void finishSnapshotRequest(bool diff) {
+  JsonDocument doc;
+  bool blobMode = diff && g_server->arg("mode") == "blob";
+  uint8_t files = g_snapshot_file_index;
+
+  if (blobMode && (g_snapshot_reference_failed || files < 2 ||
+                   g_snapshot_reference_len != dsp_snapshot_size())) {
+    doc["success"] = false;
+    doc["message"] = g_snapshot_reference_failed ? "Insufficient memory for reference snapshot"
+                                                 : "Blob diff needs two complete snapshot files";
+  } else if (files == 0) {
+    doc["success"] = false;
+    doc["message"] = "No snapshot uploaded";
+  } else {
+    const DSPSnapshotResult& result = dsp_snapshot_end();
+    doc["success"] = result.ok;
+    if (!result.ok) {
+      doc["message"] = result.error;
+    }
+    doc["bytes"] = result.bytes;
+    doc["elapsedMs"] = result.elapsedMs;
+    if (result.coreStopped) {
+      doc["coreStopped"] = true;
+    }
+    if (diff) {
+      doc["mode"] = blobMode ? "blob" : "live";
+      doc["paramDiffs"] = result.paramDiffs;
+      doc["programDiffs"] = result.programDiffs;
+      doc["registerDiffs"] = result.registerDiffs;
+      doc["identical"] = result.ok && !result.paramDiffs && !result.programDiffs && !result.registerDiffs;
+      JsonArray list = doc["diffs"].to<JsonArray>();
+      for (uint8_t i = 0; i < result.listedDiffs; i++) {
+        list.add(result.diffs[i].subaddress);
       }
     }
+  }
 
-    // Add register to JSON document
-    char regName[8];
-    snprintf(regName, sizeof(regName), "0x%04X", regs[i]);
-    doc["registers"][regName] = regValue;
+  free(g_snapshot_reference);
+  g_snapshot_reference = nullptr;
+  g_snapshot_reference_len = 0;
+  g_snapshot_file_index = 0;
+  sendJson(doc["success"].as<bool>() ? 200 : 400, doc);
+}
 
-    // Critical: yield and memory management
-    yield();
+void handleDSPSnapshotRestoreComplete() {
+  finishSnapshotRequest(false);
+}
+
+void handleDSPSnapshotDiffComplete() {
+  finishSnapshotRequest(true);
+}
+
+// SigmaTCP server activity (SigmaStudio network link on port 8086)
+void handleDSPSigmaTcpStats() {
+  const SigmaTcpStats& stats = sigma_tcp_getStats();
+  JsonDocument doc;
+  doc["success"] = true;
+  doc["port"] = SIGMA_TCP_PORT;
+  doc["client_connected"] = stats.clientConnected;
+  doc["connections"] = stats.connections;
+  doc["writes"] = stats.writes;
+  doc["reads"] = stats.reads;
+  doc["bytes_written"] = stats.bytesWritten;
+  doc["bytes_read"] = stats.bytesRead;
+  doc["errors"] = stats.errors;
+  doc["last_command_us"] = stats.lastCommandUs;
+  doc["max_command_us"] = stats.maxCommandUs;
+  sendJson(200, doc);
+}
 
-    // Check memory every 2 registers
-    if (i % 2 == 0 && ESP.getFreeHeap() < 2000) {
+static void addSequenceSummary(JsonDocument& doc) {
+  SeqSummary s = seq_getSummary();
+  doc["running"] = s.running;
+  doc["events"] = s.events;
+  doc["completed"] = s.completed;
+  doc["failed"] = s.failed;
+  doc["bus_busy"] = s.busBusy;
+  doc["transfers"] = s.transfers;
+  doc["max_error_us"] = s.maxErrorUs;
+  doc["avg_error_us"] = s.avgErrorUs;
+}
+
+// Load and start a timed schedule:
+// {"events":[{"t_ms":0,"addr":12,"value":0.5}, {"t_ms":250,"name":"Gain1","raw":4194304}, ...]}
+void handleDSPSequenceStart() {
+  JsonDocument doc;
+  if (!g_server->hasArg("plain")) {
+    doc["success"] = false;
+    doc["message"] = "No data provided";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonDocument req;
+  if (deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonArray list = req["events"].as<JsonArray>();
+  if (list.isNull() || list.size() == 0 || list.size() > SEQ_MAX_EVENTS) {
+    doc["success"] = false;
+    doc["message"] = "events must hold 1-256 entries";
+    sendJson(400, doc);
+    return;
+  }
+
+  seq_clear();
+  for (JsonObject e : list) {
+    // Whole milliseconds only - a float would lose microseconds past ~16 s
+    JsonVariant t = e["t_ms"];
+    if (!t.isNull() && (!t.is<uint32_t>() || t.as<uint32_t>() > UINT32_MAX / 1000)) {
+      seq_clear();
       doc["success"] = false;
-      doc["message"] = "Memory exhausted during register read";
-      sendJson(500, doc);
+      doc["message"] = "t_ms must be a whole number of milliseconds";
+      sendJson(400, doc);
       return;
     }
+    uint32_t offsetUs = (t | 0u) * 1000u;
+    int32_t value = e["raw"].is<int32_t>() ? e["raw"].as<int32_t>()
+                                           : dsp_floatTo523(e["value"] | 0.0f);
+    if (!seq_addEvent(offsetUs, resolveParamAddress(e), value)) {
+      seq_clear();
+      doc["success"] = false;
+      doc["message"] = "Unknown parameter in events";
+      sendJson(400, doc);
+      return;
+    }
+  }
+
+  bool ok = seq_start();
+  doc["success"] = ok;
+  addSequenceSummary(doc);
+  if (!ok) {
+    doc["message"] = "Sequencer timer unavailable";
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// Progress and per-event timing error (actual - scheduled)
+void handleDSPSequenceStatus() {
+  JsonDocument doc;
+  doc["success"] = true;
+  addSequenceSummary(doc);
+
+  uint16_t count;
+  const SeqEvent* events = seq_getEvents(count);
+  JsonArray list = doc["event_log"].to<JsonArray>();
+  for (uint16_t i = 0; i < count; i++) {
+    JsonObject e = list.add<JsonObject>();
+    e["t_us"] = events[i].offsetUs;
+    e["addr"] = events[i].address;
+    e["done"] = events[i].done;
+    if (events[i].done) {
+      e["ok"] = events[i].ok;
+      e["error_us"] = events[i].errorUs;
+      if (events[i].busBusy) {
+        e["bus_busy"] = true;
+      }
+    }
+  }
+  sendJson(200, doc);
+}
 
-    // Small delay for I2C bus stability
-    delay(2);
+void handleDSPSequenceStop() {
+  seq_stop();
+  JsonDocument doc;
+  doc["success"] = true;
+  addSequenceSummary(doc);
+  sendJson(200, doc);
+}
+
+// DSP targets and their group bits
+void handleDSPTargetList() {
+  JsonDocument doc;
+  doc["success"] = true;
+  JsonArray list = doc["targets"].to<JsonArray>();
+  for (uint8_t i = 0; i < dsp_getTargetCount(); i++) {
+    DSPTarget t = dsp_getTarget(i);
+    JsonObject o = list.add<JsonObject>();
+    o["addr"] = t.address;
+    o["groups"] = t.groups;
+    o["present"] = t.present;
   }
 
-  doc["success"] = anySuccess;
-  doc["message"] = anySuccess ? "Registers read successfully" : "Failed to read all registers";
-  doc["heap_after"] = ESP.getFreeHeap(); // Debug info
+  const DSPBroadcastStats& stats = dsp_getBroadcastStats();
+  doc["broadcasts"] = stats.broadcasts;
+  doc["last_skew_us"] = stats.lastSkewUs;
+  doc["max_skew_us"] = stats.maxSkewUs;
+  doc["skew_bound_us"] = DSP_BROADCAST_SKEW_MAX_US;
+  doc["over_bound"] = stats.overBound;
+  sendJson(200, doc);
+}
 
+// Replace the additional targets: {"targets":[{"addr":53,"groups":1}, ...]}
+// Listing the primary's address sets its groups (default: every group).
+void handleDSPTargets() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  dsp_clearTargets();
+  for (JsonObject t : req["targets"].as<JsonArray>()) {
+    if (!dsp_addTarget(t["addr"] | 0, t["groups"] | 1)) {
+      doc["success"] = false;
+      doc["message"] = "Invalid target or too many targets";
+      sendJson(400, doc);
+      return;
+    }
+  }
+  handleDSPTargetList();
+}
+
+// Same parameter update on every target in a group:
+// {"group":255,"params":[{"addr":12,"value":0.5}, ...]}
+void handleDSPBroadcast() {
+  const size_t MAX_PARAMS = 64;
+
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonArray list = req["params"].as<JsonArray>();
+  if (list.isNull() || list.size() == 0 || list.size() > MAX_PARAMS) {
+    doc["success"] = false;
+    doc["message"] = "params must hold 1-64 entries";
+    sendJson(400, doc);
+    return;
+  }
+
+  DSPParamWrite params[MAX_PARAMS];
+  size_t count = parseParamList(list, params);
+  bool ok = dsp_broadcastSafeload(req["group"] | DSP_GROUP_ALL, params, count);
+  const DSPBroadcastStats& stats = dsp_getBroadcastStats();
+
+  doc["success"] = ok;
+  doc["params"] = count;
+  doc["targets"] = stats.lastTargets;
+  if (ok) {
+    doc["skew_us"] = stats.lastSkewUs;
+    doc["within_bound"] = stats.lastSkewUs <= DSP_BROADCAST_SKEW_MAX_US;
+  }
+  doc["i2cUs"] = dsp_getSafeloadStats().lastUs;
+  JsonArray devices = doc["devices"].to<JsonArray>();
+  for (uint8_t d = 0; d < stats.lastTargets; d++) {
+    JsonObject o = devices.add<JsonObject>();
+    o["addr"] = stats.lastResults[d].address;
+    o["ok"] = stats.lastResults[d].ok;
+    o["transfers"] = stats.lastResults[d].transfers;
+  }
+  if (!ok) {
+    doc["message"] = dsp_getErrorString(dsp_getLastError());
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// Number or "0x..." string
+static uint32_t scriptNumber(JsonVariant v, uint32_t fallback) {
+  if (v.is<const char*>()) {
+    return strtoul(v.as<const char*>(), nullptr, 0);
+  }
+  return v | fallback;
+}
+
+// Even-length string of hex digit pairs
+static bool scriptHexValid(const char* hex) {
+  size_t n = strlen(hex);
+  if (n % 2) {
+    return false;
+  }
+  for (size_t i = 0; i < n; i++) {
+    if (!isxdigit((unsigned char)hex[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static const char* const kScriptOpNames[] = {"write", "read", "burst", "wait_bit", "delay"};
+
+// Execute an op list in one request:
+// {"stop_on_error":true,"ops":[
+//   {"op":"write","addr":"0x081C","len":2,"value":28},
+//   {"op":"wait_bit","addr":"0x081C","len":2,"mask":32,"value":0,"timeout_us":2000},
+//   {"op":"burst","addr":0,"data":"00800000"}, {"op":"read","addr":0,"len":4},
+//   {"op":"delay","us":500}]}
+void handleDSPScript() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  JsonArray list = req["ops"].as<JsonArray>();
+  if (list.isNull() || list.size() == 0 || list.size() > DSP_SCRIPT_MAX_OPS) {
+    doc["success"] = false;
+    doc["message"] = "ops must hold 1-64 entries";
+    sendJson(400, doc);
+    return;
+  }
+
+  static DSPScriptOp ops[DSP_SCRIPT_MAX_OPS];
+  static DSPScriptResult results[DSP_SCRIPT_MAX_OPS];
+  static uint8_t pool[DSP_SCRIPT_DATA_BYTES];
+  size_t count = 0;
+  uint32_t poolUsed = 0;      // 32-bit: a wrapped sum must not pass the pool check
+  uint32_t waitUs = 0;
+
+  for (JsonObject o : list) {
+    DSPScriptOp& op = ops[count];
+    const char* name = o["op"] | "";
+    int type = -1;
+    for (size_t t = 0; t < sizeof(kScriptOpNames) / sizeof(kScriptOpNames[0]); t++) {
+      if (strcmp(name, kScriptOpNames[t]) == 0) type = t;
+    }
+
+    JsonVariant lenArg = o["len"];
+    uint32_t len = lenArg.isNull() ? 1 : (lenArg.is<uint32_t>() ? lenArg.as<uint32_t>() : 0);
+    op.type = (DSPScriptOpType)type;
+    op.addr = scriptNumber(o["addr"], 0);
+    op.mask = scriptNumber(o["mask"], 0xFFFFFFFF);
+    op.value = scriptNumber(o["value"], 0);
+    op.timeoutUs = type == DSP_OP_DELAY ? (o["us"] | 0) : (o["timeout_us"] | 1000);
+    op.dataOffset = poolUsed;
+
+    const char* hex = o["data"] | "";
+    if (type == DSP_OP_BURST) {
+      if (!scriptHexValid(hex)) {
+        doc["success"] = false;
+        doc["message"] = String("Invalid hex data in op ") + count;
+        sendJson(400, doc);
+        return;
+      }
+      len = strlen(hex) / 2;
+    }
+    if (len > DSP_SCRIPT_DATA_BYTES) {
+      len = 0;                          // Rejected below
+    }
+    op.len = len;
+    if (type == DSP_OP_READ || type == DSP_OP_BURST) {
+      poolUsed += len;
+    }
+
+    bool valueOp = type == DSP_OP_WRITE || type == DSP_OP_WAIT_BIT;
+    if (type < 0 || len == 0 || (valueOp && len > DSP_SCRIPT_WRITE_MAX) ||
+        poolUsed > DSP_SCRIPT_DATA_BYTES) {
+      doc["success"] = false;
+      doc["message"] = String("Invalid op ") + count;
+      sendJson(400, doc);
+      return;
+    }
+    if (type == DSP_OP_BURST) {
+      for (uint16_t b = 0; b < len; b++) {
+        char byteHex[3] = {hex[b * 2], hex[b * 2 + 1], 0};
+        pool[op.dataOffset + b] = (uint8_t)strtoul(byteHex, nullptr, 16);
+      }
+    }
+    if (type == DSP_OP_WAIT_BIT || type == DSP_OP_DELAY) {
+      waitUs += min(op.timeoutUs, (uint32_t)DSP_SCRIPT_MAX_WAIT_US);
+    }
+    count++;
+  }
+  if (waitUs > DSP_SCRIPT_TOTAL_WAIT_US) {
+    doc["success"] = false;
+    doc["message"] = String("Waits and delays exceed ") + (DSP_SCRIPT_TOTAL_WAIT_US / 1000) + " ms";
+    sendJson(400, doc);
+    return;
+  }
+
+  unsigned long scriptStart = micros();
+  size_t executed = dsp_script_run(ops, count, pool, results, req["stop_on_error"] | true);
+  unsigned long scriptUs = micros() - scriptStart;
+
+  int failedOp = -1;
+  JsonArray out = doc["results"].to<JsonArray>();
+  for (size_t i = 0; i < executed; i++) {
+    JsonObject r = out.add<JsonObject>();
+    r["op"] = kScriptOpNames[ops[i].type];
+    r["ok"] = results[i].ok;
+    r["us"] = results[i].us;
+    if (!results[i].ok && failedOp < 0) {
+      failedOp = i;
+    }
+
+    if (ops[i].type == DSP_OP_WAIT_BIT) {
+      r["value"] = results[i].value;
+      r["polls"] = results[i].polls;
+    } else if (ops[i].type == DSP_OP_READ && results[i].ok) {
+      String hex;
+      hex.reserve(ops[i].len * 2);
+      char byteHex[3];
+      for (uint16_t b = 0; b < ops[i].len; b++) {
+        snprintf(byteHex, sizeof(byteHex), "%02X", pool[ops[i].dataOffset + b]);
+        hex += byteHex;
+      }
+      r["data"] = hex;
+    }
+  }
+
+  bool ok = failedOp < 0;
+  doc["success"] = ok;
+  doc["executed"] = executed;
+  doc["total_us"] = scriptUs;
+  if (!ok) {
+    doc["failed_op"] = failedOp;
+    doc["message"] = ops[failedOp].type == DSP_OP_WAIT_BIT ? String("Wait condition not met")
+                                                           : dsp_getErrorString(dsp_getLastError());
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// Last boot profile and reset pin
+void handleDSPBootProfileGet() {
+  JsonDocument doc;
+  doc["success"] = true;
+  doc["reset_pin"] = dsp_getResetPin();
+  addBootProfile(doc);
+  sendJson(200, doc);
+}
+
+// Reset and profile a boot: {"reset_pin":11, "baseline":true}
+// "baseline" stores this run as the reference for regression checks.
+void handleDSPBootProfile() {
+  JsonDocument req;
+  if (g_server->hasArg("plain")) {
+    deserializeJson(req, g_server->arg("plain"));
+  }
+  if (!req["reset_pin"].isNull()) {
+    int pin = req["reset_pin"] | -2;
+    if (!req["reset_pin"].is<int>() || !dsp_resetPinAllowed(pin) || !dsp_setResetPin(pin)) {
+      JsonDocument doc;
+      doc["success"] = false;
+      doc["message"] = "reset_pin is not an allowed GPIO";
+      sendJson(400, doc);
+      return;
+    }
+  }
+
+  // Without a reset pin this profiles a core restart; "reloaded" says which
+  bool ok = dsp_canSelfBoot() ? dsp_selfBoot() : dsp_profileBoot();
+  if (ok && (req["baseline"] | false)) {
+    dsp_setBootBaseline(0);
+  }
+
+  JsonDocument doc;
+  doc["success"] = ok;
+  doc["reset_pin"] = dsp_getResetPin();
+  addBootProfile(doc);
+  if (!ok) {
+    doc["message"] = "Boot did not complete";
+  }
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// Compare DSP program/parameter RAM against the EEPROM self-boot image
+void handleDSPBootVerify() {
+  DSPBootVerifyResult result = dsp_boot_verify_run();
+  JsonDocument doc;
+  doc["success"] = result.ok;
+  addBootVerify(doc, result);
   sendJson(200, doc);
 }
 
@@ -341,7 +1401,34 @@ void register_dsp_routes(WebServer &server) {
   server.on("/dsp/self_boot", HTTP_POST, handleDSPSelfBoot);
   server.on("/dsp/i2c_debug", HTTP_POST, handleDSPI2CDebug);
   server.on("/dsp/status", HTTP_GET, handleDSPStatus);
+  server.on("/dsp/status_sampler", HTTP_POST, handleDSPStatusSampler);
   server.on("/dsp/diagnostic", HTTP_GET, handleDSPDiagnostic);
   server.on("/dsp/find", HTTP_GET, handleDSPResetTest);
   server.on("/dsp/registers", HTTP_GET, handleDSPRegisters);
+  server.on("/dsp/memory", HTTP_GET, handleDSPMemory);
+  server.on("/dsp/safeload", HTTP_POST, handleDSPSafeload);
+  server.on("/dsp/param", HTTP_POST, handleDSPParamQueue);
+  server.on("/dsp/param_queue", HTTP_GET, handleDSPParamQueueStats);
+  server.on("/dsp/eq", HTTP_POST, handleDSPEqDesign);
+  server.on("/dsp/presets", HTTP_GET, handleDSPPresetList);
+  server.on("/dsp/preset", HTTP_POST, handleDSPPreset);
+  server.on("/dsp/param_map", HTTP_POST, handleDSPParamMapComplete, handleDSPParamMapUpload);
+  server.on("/dsp/param_map", HTTP_GET, handleDSPParamMapLookup);
+  server.on("/dsp/levels", HTTP_POST, handleDSPLevelsConfig);
+  server.on("/dsp/levels", HTTP_GET, handleDSPLevelsStats);
+  server.on("/dsp/levels/stream", HTTP_GET, handleDSPLevelsStream);
+  server.on("/dsp/snapshot", HTTP_GET, handleDSPSnapshot);
+  server.on("/dsp/sigma_tcp", HTTP_GET, handleDSPSigmaTcpStats);
+  server.on("/dsp/snapshot/restore", HTTP_POST, handleDSPSnapshotRestoreComplete, handleDSPSnapshotRestoreUpload);
+  server.on("/dsp/snapshot/diff", HTTP_POST, handleDSPSnapshotDiffComplete, handleDSPSnapshotDiffUpload);
+  server.on("/dsp/sequence", HTTP_POST, handleDSPSequenceStart);
+  server.on("/dsp/sequence", HTTP_GET, handleDSPSequenceStatus);
+  server.on("/dsp/sequence/stop", HTTP_POST, handleDSPSequenceStop);
+  server.on("/dsp/targets", HTTP_GET, handleDSPTargetList);
+  server.on("/dsp/targets", HTTP_POST, handleDSPTargets);
+  server.on("/dsp/broadcast", HTTP_POST, handleDSPBroadcast);
+  server.on("/dsp/script", HTTP_POST, handleDSPScript);
+  server.on("/dsp/boot_profile", HTTP_GET, handleDSPBootProfileGet);
+  server.on("/dsp/boot_profile", HTTP_POST, handleDSPBootProfile);
+  server.on("/dsp/boot_verify", HTTP_GET, handleDSPBootVerify);
 }
\ No newline at end of file
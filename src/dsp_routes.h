@@ -10,9 +10,39 @@ void handleDSPSoftReset();
 void handleDSPSelfBoot();
 void handleDSPI2CDebug();
 void handleDSPStatus();
+void handleDSPStatusSampler();
 void handleDSPDiagnostic();
 void handleDSPResetTest();
 void handleDSPRegisters();
+void handleDSPMemory();
+void handleDSPSafeload();
+void handleDSPParamQueue();
+void handleDSPParamQueueStats();
+void handleDSPEqDesign();
+void handleDSPPresetList();
+void handleDSPPreset();
+void handleDSPParamMapUpload();
+void handleDSPParamMapComplete();
+void handleDSPParamMapLookup();
+void handleDSPLevelsConfig();
+void handleDSPLevelsStats();
+void handleDSPLevelsStream();
+void handleDSPSnapshot();
+void handleDSPSnapshotRestoreUpload();
+void handleDSPSnapshotRestoreComplete();
+void handleDSPSnapshotDiffUpload();
+void handleDSPSnapshotDiffComplete();
+void handleDSPSigmaTcpStats();
+void handleDSPSequenceStart();
+void handleDSPSequenceStatus();
+void handleDSPSequenceStop();
+void handleDSPTargetList();
+void handleDSPTargets();
+void handleDSPBroadcast();
+void handleDSPScript();
+void handleDSPBootProfileGet();
+void handleDSPBootProfile();
+void handleDSPBootVerify();
 
 // DSP routes registration
 void register_dsp_routes(WebServer &server);
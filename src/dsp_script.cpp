@@ -0,0 +1,87 @@
+#include "dsp_script.h"
+#include "dsp_helper.h"
+
+static uint32_t scriptBigEndian(const uint8_t* buf, size_t len) {
+  uint32_t v = 0;
+  for (size_t i = 0; i < len; i++) {
+    v = (v << 8) | buf[i];
+  }
+  return v;
+}
+
+// Poll a register until the masked value matches or the timeout expires
+static bool scriptWaitBit(const DSPScriptOp& op, DSPScriptResult& r) {
+  uint8_t buf[4];
+  unsigned long startTime = micros();
+  uint32_t timeoutUs = min(op.timeoutUs, (uint32_t)DSP_SCRIPT_MAX_WAIT_US);
+
+  while (true) {
+    if (!dsp_readBlock(op.addr, buf, op.len)) {
+      return false;
+    }
+    r.polls++;
+    r.value = scriptBigEndian(buf, op.len);
+    if ((r.value & op.mask) == op.value) {
+      return true;
+    }
+    if (micros() - startTime > timeoutUs) {
+      return false;
+    }
+    delayMicroseconds(20);
+  }
+}
+
+static bool scriptRunOp(const DSPScriptOp& op, uint8_t* pool, DSPScriptResult& r) {
+  switch (op.type) {
+    case DSP_OP_WRITE: {
+      uint8_t buf[DSP_SCRIPT_WRITE_MAX];
+      if (op.len < 1 || op.len > sizeof(buf)) {
+        return false;
+      }
+      for (uint16_t i = 0; i < op.len; i++) {
+        buf[i] = (uint8_t)(op.value >> (8 * (op.len - 1 - i)));
+      }
+      return dsp_writeBlock(op.addr, buf, op.len);
+    }
+    case DSP_OP_READ:
+      return dsp_readBlock(op.addr, pool + op.dataOffset, op.len);
+    case DSP_OP_BURST:
+      return dsp_writeBlock(op.addr, pool + op.dataOffset, op.len);
+    case DSP_OP_WAIT_BIT:
+      return op.len >= 1 && op.len <= DSP_SCRIPT_WRITE_MAX && scriptWaitBit(op, r);
+    case DSP_OP_DELAY:
+      delayMicroseconds(min(op.timeoutUs, (uint32_t)DSP_SCRIPT_MAX_WAIT_US));
+      return true;
+  }
+  return false;
+}
+
+size_t dsp_script_run(const DSPScriptOp* ops, size_t count, uint8_t* pool,
+                      DSPScriptResult* results, bool stopOnError) {
+  size_t executed = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    DSPScriptResult& r = results[i];
+    memset(&r, 0, sizeof(r));
+
+    if ((ops[i].type == DSP_OP_READ || ops[i].type == DSP_OP_BURST) &&
+        ops[i].dataOffset + ops[i].len > DSP_SCRIPT_DATA_BYTES) {
+      r.ok = false;
+    } else {
+      bool busOp = ops[i].type != DSP_OP_WAIT_BIT && ops[i].type != DSP_OP_DELAY;
+      unsigned long opStart = micros();
+      uint8_t bus = busOp ? dsp_busLock() : 0;
+      r.ok = scriptRunOp(ops[i], pool, r);
+      if (busOp) dsp_busUnlock(bus);
+      r.us = micros() - opStart;
+    }
+    executed++;
+
+    if (!r.ok) {
+      Serial.printf("DSP script: op %u failed at 0x%04X\n", (unsigned)i, ops[i].addr);
+      if (stopOnError) break;
+    }
+  }
+
+  return executed;
+}
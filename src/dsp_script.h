@@ -0,0 +1,46 @@
+#ifndef DSP_SCRIPT_H
+#define DSP_SCRIPT_H
+
+#include <Arduino.h>
+
+// Bring-up/diagnostic op lists executed in one request
+#define DSP_SCRIPT_MAX_OPS      64
+#define DSP_SCRIPT_DATA_BYTES   1024    // Shared pool for burst data and read results
+#define DSP_SCRIPT_MAX_WAIT_US  100000  // Cap for wait and delay ops
+#define DSP_SCRIPT_TOTAL_WAIT_US 500000 // Cap for all wait and delay ops of a script
+#define DSP_SCRIPT_WRITE_MAX    4       // Value bytes of write and wait_bit ops
+
+enum DSPScriptOpType : uint8_t {
+  DSP_OP_WRITE,       // len (1-4) bytes of value, big-endian, one transaction
+  DSP_OP_READ,        // len bytes from addr into the pool
+  DSP_OP_BURST,       // len bytes from the pool to addr (split into bursts)
+  DSP_OP_WAIT_BIT,    // Poll len (1-4) bytes until (reg & mask) == value
+  DSP_OP_DELAY        // Wait timeoutUs
+};
+
+struct DSPScriptOp {
+  DSPScriptOpType type;
+  uint16_t addr;
+  uint16_t len;
+  uint16_t dataOffset;  // Pool offset for read/burst
+  uint32_t mask;
+  uint32_t value;
+  uint32_t timeoutUs;   // Wait timeout or delay length
+};
+
+struct DSPScriptResult {
+  bool ok;
+  uint32_t us;          // Time spent in the op
+  uint32_t value;       // Last polled value (wait ops)
+  uint16_t polls;
+};
+
+// Run ops in order. Each write, read and burst holds the DSP bus lock for
+// its own transactions only; waits and delays run unlocked (wait_bit locks
+// per poll), so timer-driven safeloads are never held off for long. Read
+// ops store their bytes in the pool at dataOffset. Returns the number of
+// ops executed.
+size_t dsp_script_run(const DSPScriptOp* ops, size_t count, uint8_t* pool,
+                      DSPScriptResult* results, bool stopOnError);
+
+#endif // DSP_SCRIPT_H
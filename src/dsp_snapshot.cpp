@@ -0,0 +1,285 @@
+#include "dsp_snapshot.h"
+#include "config.h"
+#include "i2c_bus.h"
+
+// Snapshot body items in blob order. Memories are read as whole bursts;
+// registers one transaction each at their native width. Safeload and data
+// capture registers are transient and left out.
+struct SnapshotItem {
+  uint16_t subaddress;
+  uint16_t length;
+};
+
+static const SnapshotItem snapshotItems[] = {
+  {ADAU1701_PARAM_RAM_START, ADAU1701_PARAM_RAM_WORDS * ADAU1701_PARAM_WORD_BYTES},
+  {ADAU1701_PROG_RAM_START, ADAU1701_PROG_RAM_WORDS * ADAU1701_PROG_WORD_BYTES},
+  {ADAU1701_CORE_CONTROL_REG, 2},
+  {0x081E, 2},   // Serial output control
+  {0x081F, 1},   // Serial input control
+  {0x0820, 3},   // Multipurpose pin config 0
+  {0x0821, 3},   // Multipurpose pin config 1
+  {0x0822, 2},   // Auxiliary ADC and power control
+  {0x0824, 2},   // Auxiliary ADC enable
+  {0x0826, 2},   // Oscillator power-down
+  {0x0827, 2}    // DAC setup
+};
+static const uint8_t SNAPSHOT_ITEM_COUNT = sizeof(snapshotItems) / sizeof(snapshotItems[0]);
+static const uint8_t SNAPSHOT_FIRST_REGISTER = 2;
+
+static uint16_t snapshotRegisterBytes() {
+  uint16_t total = 0;
+  for (uint8_t i = SNAPSHOT_FIRST_REGISTER; i < SNAPSHOT_ITEM_COUNT; i++) {
+    total += snapshotItems[i].length;
+  }
+  return total;
+}
+
+size_t dsp_snapshot_size() {
+  size_t total = sizeof(DSPSnapshotHeader);
+  for (uint8_t i = 0; i < SNAPSHOT_ITEM_COUNT; i++) {
+    total += snapshotItems[i].length;
+  }
+  return total;
+}
+
+static void fillHeader(DSPSnapshotHeader& header) {
+  header.magic = DSP_SNAPSHOT_MAGIC;
+  header.version = DSP_SNAPSHOT_VERSION;
+  header.registerCount = SNAPSHOT_ITEM_COUNT - SNAPSHOT_FIRST_REGISTER;
+  header.paramBytes = snapshotItems[0].length;
+  header.programBytes = snapshotItems[1].length;
+  header.registerBytes = snapshotRegisterBytes();
+  header.capturedMs = millis();
+}
+
+// Largest word-aligned piece of an item starting at offset
+static size_t itemChunk(const SnapshotItem& item, uint16_t offset) {
+  size_t wordBytes = dsp_memoryWordBytes(item.subaddress);
+  if (wordBytes == 0) {
+    return item.length - offset;  // Registers go as one transaction
+  }
+  size_t maxChunk = (DSP_BURST_MAX_DATA / wordBytes) * wordBytes;
+  return min(maxChunk, (size_t)(item.length - offset));
+}
+
+static uint16_t itemSubaddress(const SnapshotItem& item, uint16_t offset) {
+  size_t wordBytes = dsp_memoryWordBytes(item.subaddress);
+  return wordBytes ? item.subaddress + offset / wordBytes : item.subaddress;
+}
+
+bool dsp_snapshot_capture(DSPSnapshotSink sink, uint32_t* elapsedMs) {
+  unsigned long startTime = millis();
+
+  DSPSnapshotHeader header;
+  fillHeader(header);
+  sink((const uint8_t*)&header, sizeof(header));
+
+  uint8_t buf[DSP_BURST_MAX_DATA];
+  bool ok = true;
+  for (uint8_t i = 0; i < SNAPSHOT_ITEM_COUNT; i++) {
+    const SnapshotItem& item = snapshotItems[i];
+    for (uint16_t offset = 0; offset < item.length;) {
+      size_t n = itemChunk(item, offset);
+      if (ok) {
+        // Bus held per chunk only - the sink may block on the network
+        uint8_t bus = dsp_busLock();
+        i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+        ok = dsp_readBlock(itemSubaddress(item, offset), buf, n);
+        i2c_setClock(bus, 0);
+        dsp_busUnlock(bus);  // On failure keep the blob length intact; caller reports it
+      }
+      if (!ok) {
+        memset(buf, 0, n);
+      }
+      sink(buf, n);
+      offset += n;
+    }
+    yield();
+  }
+
+  if (elapsedMs) {
+    *elapsedMs = millis() - startTime;
+  }
+  Serial.printf("DSP snapshot: %u bytes in %lu ms%s\n", (unsigned)dsp_snapshot_size(),
+                millis() - startTime, ok ? "" : " (READ ERRORS)");
+  return ok;
+}
+
+// Streaming restore/diff state
+static DSPSnapshotMode snapMode;
+static const uint8_t* snapReference;
+static DSPSnapshotResult snapResult;
+static DSPSnapshotHeader snapHeader;
+static uint32_t snapOffset;          // Bytes consumed, header included
+static uint8_t snapItem;
+static uint16_t snapItemOffset;      // Offset of snapStage[0] within the item
+static uint8_t snapStage[DSP_BURST_MAX_DATA];
+static size_t snapStageLen;
+static unsigned long snapStartMs;
+static bool snapCoreStopped;         // Restore: core held since the first write
+static uint8_t snapCoreControl[2];   // Restore: core control value from the blob
+
+static void snapshotFail(const char* error) {
+  if (snapResult.ok) {
+    snapResult.ok = false;
+    snapResult.error = error;
+  }
+}
+
+static void recordDiffs(const uint8_t* expected, const uint8_t* actual, size_t length) {
+  const SnapshotItem& item = snapshotItems[snapItem];
+  size_t wordBytes = dsp_memoryWordBytes(item.subaddress);
+  size_t step = wordBytes ? wordBytes : length;
+
+  for (size_t i = 0; i < length; i += step) {
+    if (memcmp(expected + i, actual + i, step) == 0) {
+      continue;
+    }
+    if (snapItem == 0) snapResult.paramDiffs++;
+    else if (snapItem == 1) snapResult.programDiffs++;
+    else snapResult.registerDiffs++;
+
+    if (snapResult.listedDiffs < DSP_SNAPSHOT_MAX_DIFFS) {
+      DSPSnapshotDiff& d = snapResult.diffs[snapResult.listedDiffs++];
+      d.subaddress = itemSubaddress(item, snapItemOffset + i);
+      d.offset = (snapItemOffset + i) / step;
+    }
+  }
+}
+
+// Hold the core with its registers cleared while RAM is rewritten, so the
+// DSP never executes a half-loaded program
+static bool stopCore() {
+  uint8_t cc[2];
+  if (!dsp_readBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc))) {
+    return false;
+  }
+  cc[1] &= ~(ADAU1701_CORE_CONTROL_CR | ADAU1701_CORE_CONTROL_IST);
+  return dsp_writeBlock(ADAU1701_CORE_CONTROL_REG, cc, sizeof(cc));
+}
+
+// Apply the staged piece of the current item
+static void flushStage() {
+  const SnapshotItem& item = snapshotItems[snapItem];
+  uint16_t subaddress = itemSubaddress(item, snapItemOffset);
+
+  uint8_t bus = dsp_busLock();
+  i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+  if (snapMode == DSP_SNAPSHOT_RESTORE) {
+    if (!snapCoreStopped) {
+      snapCoreStopped = stopCore();
+      if (!snapCoreStopped) {
+        snapshotFail("Core stop failed");
+        i2c_setClock(bus, 0);
+        dsp_busUnlock(bus);
+        return;
+      }
+    }
+    if (subaddress == ADAU1701_CORE_CONTROL_REG) {
+      // Applied last, in dsp_snapshot_end(); the core stays held until then
+      memcpy(snapCoreControl, snapStage, sizeof(snapCoreControl));
+      snapCoreControl[1] &= ~ADAU1701_CORE_CONTROL_IST;  // Never start a stale safeload
+      snapStage[1] &= ~(ADAU1701_CORE_CONTROL_CR | ADAU1701_CORE_CONTROL_IST);
+    }
+    if (!dsp_writeBlock(subaddress, snapStage, snapStageLen)) {
+      snapshotFail("DSP write failed");
+    }
+  } else if (snapMode == DSP_SNAPSHOT_DIFF_LIVE) {
+    uint8_t live[DSP_BURST_MAX_DATA];
+    if (!dsp_readBlock(subaddress, live, snapStageLen)) {
+      snapshotFail("DSP read failed");
+    } else {
+      recordDiffs(live, snapStage, snapStageLen);
+    }
+  } else if (snapReference) {
+    recordDiffs(snapReference + (snapOffset - snapStageLen), snapStage, snapStageLen);
+  } else {
+    snapshotFail("No reference snapshot");
+  }
+  i2c_setClock(bus, 0);
+  dsp_busUnlock(bus);
+
+  snapItemOffset += snapStageLen;
+  snapStageLen = 0;
+  if (snapItemOffset >= item.length) {
+    snapItem++;
+    snapItemOffset = 0;
+  }
+}
+
+void dsp_snapshot_begin(DSPSnapshotMode mode, const uint8_t* reference) {
+  memset(&snapResult, 0, sizeof(snapResult));
+  snapResult.ok = true;
+  snapMode = mode;
+  snapReference = reference;
+  snapOffset = 0;
+  snapItem = 0;
+  snapItemOffset = 0;
+  snapStageLen = 0;
+  snapStartMs = millis();
+  snapCoreStopped = false;
+  if (mode == DSP_SNAPSHOT_DIFF_BLOB && !reference) {
+    snapshotFail("No reference snapshot");
+  }
+}
+
+void dsp_snapshot_feed(const uint8_t* data, size_t length) {
+  size_t i = 0;
+
+  // Header first - validate layout before touching the DSP
+  while (i < length && snapOffset < sizeof(DSPSnapshotHeader)) {
+    ((uint8_t*)&snapHeader)[snapOffset++] = data[i++];
+    if (snapOffset == sizeof(DSPSnapshotHeader)) {
+      DSPSnapshotHeader expected;
+      fillHeader(expected);
+      if (snapHeader.magic != DSP_SNAPSHOT_MAGIC || snapHeader.version != DSP_SNAPSHOT_VERSION ||
+          snapHeader.paramBytes != expected.paramBytes || snapHeader.programBytes != expected.programBytes ||
+          snapHeader.registerBytes != expected.registerBytes) {
+        snapshotFail("Not a DSP snapshot (bad header)");
+      }
+    }
+  }
+
+  while (i < length && snapResult.ok && snapItem < SNAPSHOT_ITEM_COUNT) {
+    size_t want = itemChunk(snapshotItems[snapItem], snapItemOffset);
+    size_t n = min(want - snapStageLen, length - i);
+    memcpy(snapStage + snapStageLen, data + i, n);
+    snapStageLen += n;
+    snapOffset += n;
+    i += n;
+    if (snapStageLen == want) {
+      flushStage();
+    }
+  }
+
+  if (i < length && snapResult.ok) {
+    snapshotFail("Snapshot longer than expected");
+  }
+}
+
+const DSPSnapshotResult& dsp_snapshot_end() {
+  if (snapResult.ok && snapOffset != dsp_snapshot_size()) {
+    snapshotFail("Snapshot truncated");
+  }
+  if (snapCoreStopped && snapResult.ok) {
+    // Every register is back - start the core with the blob's setting
+    if (dsp_writeBlock(ADAU1701_CORE_CONTROL_REG, snapCoreControl, sizeof(snapCoreControl))) {
+      snapCoreStopped = false;
+    } else {
+      snapshotFail("Core restart failed");
+    }
+  }
+  snapResult.coreStopped = snapCoreStopped;
+  if (snapCoreStopped) {
+    Serial.printf("DSP snapshot: restore failed (%s), core left stopped\n", snapResult.error);
+  }
+  snapResult.bytes = snapOffset > sizeof(DSPSnapshotHeader) ? snapOffset - sizeof(DSPSnapshotHeader) : 0;
+  snapResult.elapsedMs = millis() - snapStartMs;
+  return snapResult;
+}
+
+// Upload dropped part way: nothing more will arrive
+void dsp_snapshot_abort() {
+  snapshotFail("Upload aborted");
+  dsp_snapshot_end();
+}
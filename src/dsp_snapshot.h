@@ -0,0 +1,66 @@
+#ifndef DSP_SNAPSHOT_H
+#define DSP_SNAPSHOT_H
+
+#include <Arduino.h>
+#include "dsp_helper.h"
+
+// Snapshot blob: header, parameter RAM (4096 bytes), program RAM (5120
+// bytes), then the control registers listed in dsp_snapshot.cpp.
+#define DSP_SNAPSHOT_MAGIC    0x4E534441  // "ADSN"
+#define DSP_SNAPSHOT_VERSION  1
+#define DSP_SNAPSHOT_MAX_DIFFS 32         // Differing words listed individually
+
+struct DSPSnapshotHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t registerCount;
+  uint16_t paramBytes;
+  uint16_t programBytes;
+  uint16_t registerBytes;
+  uint32_t capturedMs;
+} __attribute__((packed));
+
+// Total blob length
+size_t dsp_snapshot_size();
+
+// Capture: fill the header, then read the body in order through the callback
+// (bursts of at most DSP_BURST_MAX_DATA bytes). Returns false on a bus error.
+typedef void (*DSPSnapshotSink)(const uint8_t* data, size_t length);
+bool dsp_snapshot_capture(DSPSnapshotSink sink, uint32_t* elapsedMs);
+
+enum DSPSnapshotMode {
+  DSP_SNAPSHOT_RESTORE,     // Write the blob back to the DSP
+  DSP_SNAPSHOT_DIFF_LIVE,   // Compare the blob with the running DSP
+  DSP_SNAPSHOT_DIFF_BLOB    // Compare the blob with a reference blob
+};
+
+struct DSPSnapshotDiff {
+  uint16_t subaddress;
+  uint16_t offset;          // Word offset within the subaddress item
+};
+
+struct DSPSnapshotResult {
+  bool ok;
+  const char* error;
+  uint32_t bytes;           // Body bytes processed
+  uint32_t elapsedMs;
+  uint16_t paramDiffs;      // Differing words per region (diff modes)
+  uint16_t programDiffs;
+  uint16_t registerDiffs;
+  bool coreStopped;         // Restore failed after stopping the core; left stopped
+  uint8_t listedDiffs;
+  DSPSnapshotDiff diffs[DSP_SNAPSHOT_MAX_DIFFS];
+};
+
+// Streaming restore/diff of an uploaded blob, any chunk size.
+// reference is only used (and must hold dsp_snapshot_size() bytes) for DIFF_BLOB.
+// A restore holds the core (CR clear in core control) from the first RAM
+// write until the last register is written, then sets the core control
+// value from the blob. A failed restore leaves the core stopped rather
+// than running a partly written program.
+void dsp_snapshot_begin(DSPSnapshotMode mode, const uint8_t* reference);
+void dsp_snapshot_feed(const uint8_t* data, size_t length);
+const DSPSnapshotResult& dsp_snapshot_end();
+void dsp_snapshot_abort();
+
+#endif // DSP_SNAPSHOT_H
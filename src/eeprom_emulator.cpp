@@ -0,0 +1,263 @@
+#include "eeprom_emulator.h"
+#include "config.h"
+#include "eeprom_manager.h"
+#include "i2c_bus.h"
+#include "selfboot_image.h"
+#include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static uint8_t* emuImage = nullptr;
+static EepromEmuStats emuStats;
+static uint16_t emuPointer = 0;
+static bool emuQueued = false;               // Read data queued since the last address write
+static size_t emuQueueBytes = EMU_TX_BUFFER_SIZE;
+static SemaphoreHandle_t emuLock = nullptr;  // Slave callbacks vs. staging
+
+static bool emuAllocate() {
+  if (!emuImage) {
+    emuImage = (uint8_t*)ps_malloc(EEPROM_SIZE);
+    if (!emuImage) {
+      emuImage = (uint8_t*)malloc(EEPROM_SIZE);
+    }
+    if (!emuImage) {
+      Serial.println("EEPROM emu: no memory for image");
+      return false;
+    }
+    memset(emuImage, 0xFF, EEPROM_SIZE);
+  }
+  return true;
+}
+
+bool eeprom_emu_stage(const uint8_t* data, size_t length, size_t offset) {
+  if (!emuAllocate() || offset + length > EEPROM_SIZE) {
+    return false;
+  }
+  if (offset == 0) {
+    memset(emuImage, 0xFF, EEPROM_SIZE);
+    emuStats.imageLength = 0;
+  }
+  memcpy(emuImage + offset, data, length);
+  emuStats.imageLength = max(emuStats.imageLength, (uint32_t)(offset + length));
+  return true;
+}
+
+// Copy the used region of the physical chip (image plus blank margin)
+bool eeprom_emu_stageFromEEPROM() {
+  SelfBootImageInfo info = selfboot_analyzeEEPROM();
+  uint32_t length = selfboot_usedRegion(info);
+  if (!emuAllocate()) {
+    return false;
+  }
+  memset(emuImage, 0xFF, EEPROM_SIZE);
+  if (!readBlockFromEEPROM(0, emuImage, length)) {
+    return false;
+  }
+  emuStats.imageLength = length;
+  return true;
+}
+
+void eeprom_emu_clear() {
+  eeprom_emu_stop();
+  free(emuImage);
+  emuImage = nullptr;
+  memset(&emuStats, 0, sizeof(emuStats));
+  emuPointer = 0;
+}
+
+// Master write: two address bytes, then data bytes that wrap within the
+// 64-byte page like the real chip
+void eeprom_emu_onWrite(const uint8_t* data, size_t length) {
+  if (length < 2 || !emuImage) {
+    return;
+  }
+  emuPointer = (((uint16_t)data[0] << 8) | data[1]) % EEPROM_SIZE;
+  emuStats.addressSets++;
+
+  uint16_t pageBase = emuPointer - (emuPointer % EEPROM_PAGE_SIZE);
+  uint16_t offset = emuPointer % EEPROM_PAGE_SIZE;
+  for (size_t i = 2; i < length; i++) {
+    emuImage[pageBase + offset] = data[i];
+    offset = (offset + 1) % EEPROM_PAGE_SIZE;
+    emuStats.bytesWritten++;
+  }
+  if (length > 2) {
+    emuPointer = pageBase + offset;
+  }
+  emuStats.pointer = emuPointer;
+}
+
+// Master read: sequential from the pointer, rolling over to 0 at the end
+size_t eeprom_emu_onRead(uint8_t* out, size_t length) {
+  if (!emuImage) {
+    return 0;
+  }
+  for (size_t i = 0; i < length; i++) {
+    out[i] = emuImage[emuPointer];
+    emuPointer = (emuPointer + 1) % EEPROM_SIZE;
+  }
+  emuStats.bytesServed += length;
+  emuStats.pointer = emuPointer;
+  return length;
+}
+
+// Hand the driver the image from the pointer on. On the S2 core
+// slaveWrite resets the driver's TX queue before queueing, so this also
+// flushes whatever an earlier read left unclocked - the next read starts
+// at the pointer, as on the real chip.
+static void emuQueueFromPointer() {
+  size_t n = min(emuQueueBytes, (size_t)(EEPROM_SIZE - emuPointer));
+  emuStats.bytesServed += Wire1.slaveWrite(emuImage + emuPointer, n);
+  emuQueued = true;
+}
+
+static void emuOnReceive(int /* count */) {
+  uint8_t buf[2 + EEPROM_PAGE_SIZE] = {};
+  size_t n = 0;
+  while (Wire1.available() && n < sizeof(buf)) {
+    buf[n++] = Wire1.read();
+  }
+  xSemaphoreTake(emuLock, portMAX_DELAY);
+  eeprom_emu_onWrite(buf, n);
+  // Queue at once: a random read follows the address write with a
+  // repeated start, too soon to fill the queue from onRequest
+  if (n >= 2) {
+    emuQueueFromPointer();
+  }
+  xSemaphoreGive(emuLock);
+}
+
+// A read that follows an earlier read continues from the queued data;
+// only a read with nothing queued yet (first one after start) queues here
+static void emuOnRequest() {
+  emuStats.readRequests++;
+  xSemaphoreTake(emuLock, portMAX_DELAY);
+  if (!emuQueued) {
+    emuQueueFromPointer();
+  }
+  xSemaphoreGive(emuLock);
+}
+
+bool eeprom_emu_start() {
+  if (emuStats.active) {
+    return true;
+  }
+  if (!emuImage) {
+    Serial.println("EEPROM emu: no image staged");
+    return false;
+  }
+
+  if (i2c_busActive(1)) {
+    Serial.println("EEPROM emu: Wire1 is in use as an I2C master bus");
+    return false;
+  }
+
+  if (!emuLock) {
+    emuLock = xSemaphoreCreateMutex();
+  }
+  // One queue fill must cover the DSP's whole boot read: topping it up
+  // later would discard bytes the master has not clocked out yet
+  emuQueueBytes = min((size_t)EEPROM_SIZE, max((size_t)EMU_TX_BUFFER_SIZE, (size_t)emuStats.imageLength));
+  Wire1.setBufferSize(emuQueueBytes);
+  Wire1.onReceive(emuOnReceive);
+  Wire1.onRequest(emuOnRequest);
+  if (!Wire1.begin((uint8_t)EEPROM_I2C_ADDRESS, EMU_SDA_PIN, EMU_SCL_PIN, 0)) {
+    Serial.println("EEPROM emu: Wire1 slave init failed");
+    return false;
+  }
+
+  emuPointer = 0;
+  emuQueued = false;
+  emuStats.pointer = 0;
+  emuStats.active = true;
+  Serial.printf("EEPROM emu: serving %u bytes at 0x%02X on SDA %d / SCL %d\n",
+                emuStats.imageLength, EEPROM_I2C_ADDRESS, EMU_SDA_PIN, EMU_SCL_PIN);
+  return true;
+}
+
+void eeprom_emu_stop() {
+  if (!emuStats.active) {
+    return;
+  }
+  emuStats.active = false;
+  Wire1.end();
+  Serial.println("EEPROM emu: stopped");
+}
+
+const EepromEmuStats& eeprom_emu_getStats() {
+  return emuStats;
+}
+
+// Master-side replay of what the DSP and a programmer do on the bus
+bool eeprom_emu_selfTest(String& report) {
+  if (!emuImage) {
+    report = "No image staged";
+    return false;
+  }
+  // The replay moves the pointer and patches the image - not while a
+  // master may be reading them
+  if (emuStats.active) {
+    report = "Emulator is serving Wire1 - stop it first";
+    return false;
+  }
+
+  bool ok = true;
+  uint8_t buf[EEPROM_PAGE_SIZE + 2];
+  uint8_t saved[EEPROM_PAGE_SIZE];
+  uint16_t savedPointer = emuPointer;
+  EepromEmuStats savedStats = emuStats;
+
+  // 1. Boot read: address 0x0000, then 32-byte sequential reads until the
+  //    walker sees the END message - the stream must match the staged image
+  uint8_t addr0[2] = {0, 0};
+  eeprom_emu_onWrite(addr0, sizeof(addr0));
+  selfboot_begin();
+  uint32_t offset = 0;
+  bool streamMatches = true;
+  while (offset < EEPROM_SIZE) {
+    eeprom_emu_onRead(buf, 32);
+    streamMatches &= (memcmp(buf, emuImage + offset, 32) == 0);
+    offset += 32;
+    if (!selfboot_feed(buf, 32)) break;
+  }
+  const SelfBootImageInfo& info = selfboot_getInfo();
+  report += String("boot read: ") + (info.valid ? "valid image, " : "no valid image, ") +
+            info.imageLength + " bytes, stream " + (streamMatches ? "matches" : "MISMATCH") + "\n";
+  ok &= streamMatches;
+
+  // 2. Random reads: pointer set, one byte read, pointer advances
+  bool randomOk = true;
+  for (uint16_t a = 1; a < EEPROM_SIZE; a = a * 3 + 7) {
+    uint8_t setAddr[2] = {(uint8_t)(a >> 8), (uint8_t)a};
+    eeprom_emu_onWrite(setAddr, sizeof(setAddr));
+    eeprom_emu_onRead(buf, 2);
+    randomOk &= (buf[0] == emuImage[a] && buf[1] == emuImage[(a + 1) % EEPROM_SIZE]);
+  }
+  report += String("random reads: ") + (randomOk ? "ok" : "FAIL") + "\n";
+  ok &= randomOk;
+
+  // 3. Rollover: the last byte is followed by address 0
+  uint8_t lastAddr[2] = {(uint8_t)((EEPROM_SIZE - 1) >> 8), (uint8_t)(EEPROM_SIZE - 1)};
+  eeprom_emu_onWrite(lastAddr, sizeof(lastAddr));
+  eeprom_emu_onRead(buf, 2);
+  bool rolloverOk = (buf[0] == emuImage[EEPROM_SIZE - 1] && buf[1] == emuImage[0]);
+  report += String("rollover: ") + (rolloverOk ? "ok" : "FAIL") + "\n";
+  ok &= rolloverOk;
+
+  // 4. Page write wrap: 4 bytes at page offset 62 land at 62, 63, 0, 1
+  uint16_t page = EEPROM_SIZE - EEPROM_PAGE_SIZE;
+  memcpy(saved, emuImage + page, EEPROM_PAGE_SIZE);
+  uint16_t at = page + EEPROM_PAGE_SIZE - 2;
+  uint8_t pageWrite[6] = {(uint8_t)(at >> 8), (uint8_t)at, 0xA1, 0xA2, 0xA3, 0xA4};
+  eeprom_emu_onWrite(pageWrite, sizeof(pageWrite));
+  bool wrapOk = emuImage[at] == 0xA1 && emuImage[at + 1] == 0xA2 &&
+                emuImage[page] == 0xA3 && emuImage[page + 1] == 0xA4;
+  memcpy(emuImage + page, saved, EEPROM_PAGE_SIZE);
+  report += String("page write wrap: ") + (wrapOk ? "ok" : "FAIL") + "\n";
+  ok &= wrapOk;
+
+  // The replay is not bus traffic - leave the live state untouched
+  emuPointer = savedPointer;
+  emuStats = savedStats;
+  return ok;
+}
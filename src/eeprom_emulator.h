@@ -0,0 +1,47 @@
+#ifndef EEPROM_EMULATOR_H
+#define EEPROM_EMULATOR_H
+
+#include <Arduino.h>
+
+// 24LC256 emulation on the second I2C controller: the ADAU1701 self-boots
+// from an image staged in RAM (PSRAM when present) instead of the chip.
+//
+// The protocol core (address pointer, sequential read with rollover,
+// page-wrapped writes) is independent of the bus so it can be exercised
+// by eeprom_emu_selfTest(). The Wire1 glue queues the image from the
+// pointer on at each address write, replacing (flushing) anything left
+// queued, so reads always start at the address the master set. The slave
+// API does not report bytes clocked out, so the pointer stays at the last
+// address set while the master reads on through the queue.
+
+struct EepromEmuStats {
+  bool active;              // Slave running on Wire1
+  uint32_t imageLength;     // Bytes staged (rest reads as 0xFF)
+  uint32_t addressSets;     // Address writes from the master
+  uint32_t readRequests;    // Read transactions
+  uint32_t bytesServed;     // Bytes queued to the slave driver
+  uint32_t bytesWritten;    // Data bytes written by the master
+  uint16_t pointer;         // Last address set by the master
+};
+
+// Image staging (whole 32KB array, unused tail 0xFF)
+bool eeprom_emu_stage(const uint8_t* data, size_t length, size_t offset);
+bool eeprom_emu_stageFromEEPROM();
+void eeprom_emu_clear();
+
+// Protocol core - what the slave does for each master transaction
+void eeprom_emu_onWrite(const uint8_t* data, size_t length);
+size_t eeprom_emu_onRead(uint8_t* out, size_t length);
+
+// Bus glue - Wire1 slave at EEPROM_I2C_ADDRESS on EMU_SDA_PIN/EMU_SCL_PIN
+bool eeprom_emu_start();
+void eeprom_emu_stop();
+
+const EepromEmuStats& eeprom_emu_getStats();
+
+// Replays the ADAU1701 boot sequence (address 0, sequential read to the END
+// message) plus random reads, rollover and page writes against the core.
+// Refused while the emulator is serving the bus.
+bool eeprom_emu_selfTest(String& report);
+
+#endif // EEPROM_EMULATOR_H
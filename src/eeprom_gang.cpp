@@ -0,0 +1,344 @@
+#include "eeprom_gang.h"
+#include "config.h"
+#include "eeprom_manager.h"
+#include "i2c_bus.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define GANG_MUX_UNKNOWN 0xFFFF
+
+struct GangImage {
+  uint8_t* data;
+  uint32_t length;
+};
+
+// Per-socket progress through its image during gang_program()
+struct GangCursor {
+  uint16_t nextPage;
+  uint16_t pages;
+  bool busy;                // Write cycle started, not yet acknowledged
+  bool done;
+  uint32_t writeStartUs;
+};
+
+static GangImage gangImages[GANG_MAX_IMAGES];
+static GangSocket gangSockets[GANG_MAX_SOCKETS];
+static uint8_t gangSocketCount = 0;
+static uint16_t gangMuxMask[I2C_BUS_COUNT] = { GANG_MUX_UNKNOWN, GANG_MUX_UNKNOWN };
+
+// State of the current run, shared by the bus jobs
+static GangReport gangReport;
+static GangCursor gangCursors[GANG_MAX_SOCKETS];
+static bool gangVerifyRun = false;
+static volatile uint8_t gangJobsLeft = 0;
+static portMUX_TYPE gangJobMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool gang_stageImage(uint8_t slot, const uint8_t* data, size_t length, size_t offset) {
+  if (slot >= GANG_MAX_IMAGES || offset + length > EEPROM_SIZE) {
+    return false;
+  }
+  GangImage& img = gangImages[slot];
+  if (!img.data) {
+    img.data = (uint8_t*)ps_malloc(EEPROM_SIZE);
+    if (!img.data) {
+      img.data = (uint8_t*)malloc(EEPROM_SIZE);
+    }
+    if (!img.data) {
+      Serial.println("Gang: no memory for image");
+      return false;
+    }
+  }
+  if (offset == 0) {
+    memset(img.data, 0xFF, EEPROM_SIZE);
+    img.length = 0;
+  }
+  memcpy(img.data + offset, data, length);
+  img.length = max(img.length, (uint32_t)(offset + length));
+  return true;
+}
+
+uint32_t gang_getImageLength(uint8_t slot) {
+  return slot < GANG_MAX_IMAGES ? gangImages[slot].length : 0;
+}
+
+void gang_clearImages() {
+  for (uint8_t i = 0; i < GANG_MAX_IMAGES; i++) {
+    free(gangImages[i].data);
+    gangImages[i].data = nullptr;
+    gangImages[i].length = 0;
+  }
+}
+
+// Enable exactly the socket's mux channel (none for a direct socket).
+// Caller holds the bus lock.
+static bool gangSelect(const GangSocket& s) {
+  uint16_t mask = (s.muxChannel == GANG_MUX_NONE) ? 0 : (1 << s.muxChannel);
+  uint16_t& current = gangMuxMask[s.bus];
+  if (mask == current) {
+    return true;
+  }
+  TwoWire& wire = i2c_wire(s.bus);
+  wire.beginTransmission(GANG_MUX_I2C_ADDRESS);
+  wire.write((uint8_t)mask);
+  bool ok = wire.endTransmission() == 0;
+  if (mask == 0 && current == GANG_MUX_UNKNOWN) {
+    ok = true;  // No mux fitted and nothing selected yet - don't require an ACK
+  }
+  current = ok ? mask : GANG_MUX_UNKNOWN;
+  return ok;
+}
+
+// Drop the mux channel, then the lock: other users of the bus must never
+// find a socket's channel still switched in
+static void gangRelease(uint8_t bus) {
+  if (gangMuxMask[bus] != 0) {
+    GangSocket none = {bus, 0, GANG_MUX_NONE, 0, false};
+    gangSelect(none);
+  }
+  i2c_unlock(bus);
+}
+
+bool gang_addSocket(uint8_t bus, uint8_t address, int8_t muxChannel, uint8_t image) {
+  if (gangSocketCount >= GANG_MAX_SOCKETS || image >= GANG_MAX_IMAGES ||
+      muxChannel < GANG_MUX_NONE || muxChannel >= GANG_MUX_CHANNELS ||
+      address < 0x08 || address > 0x77 || !i2c_busActive(bus) || gang_isRunning()) {
+    return false;
+  }
+  GangSocket& s = gangSockets[gangSocketCount++];
+  s.bus = bus;
+  s.address = address;
+  s.muxChannel = muxChannel;
+  s.image = image;
+  i2c_lock(bus);
+  s.present = gangSelect(s) && isEEPROMReady(bus, address);
+  gangRelease(bus);
+  return true;
+}
+
+void gang_clearSockets() {
+  if (!gang_isRunning()) {
+    gangSocketCount = 0;
+  }
+}
+
+uint8_t gang_getSocketCount() {
+  return gangSocketCount;
+}
+
+GangSocket gang_getSocket(uint8_t index) {
+  return index < gangSocketCount ? gangSockets[index] : GangSocket{0, 0, GANG_MUX_NONE, 0, false};
+}
+
+static void gangFail(GangCursor& c, GangSocketResult& r, const char* error, unsigned long startMs) {
+  r.ok = false;
+  r.error = error;
+  r.ms = millis() - startMs;
+  c.done = true;
+}
+
+// One page per socket per pass. A busy socket costs a single address
+// probe and is skipped; the pass only sleeps when no socket was ready.
+// The bus lock is held per socket step, so other devices on the bus wait
+// at most one page transfer, and the mux is switched off again before it
+// is released.
+static void gangProgramPass(uint8_t bus, unsigned long startMs, uint8_t& remaining, bool& progressed) {
+  for (uint8_t i = 0; i < gangSocketCount; i++) {
+    GangCursor& c = gangCursors[i];
+    GangSocketResult& r = gangReport.results[i];
+    const GangSocket& s = gangSockets[i];
+    if (c.done || s.bus != bus) {
+      continue;
+    }
+
+    i2c_lock(bus);
+    const char* error = nullptr;
+    if (!gangSelect(s)) {
+      error = "Mux channel select failed";
+    } else if (c.busy && !isEEPROMReady(bus, s.address)) {
+      r.busyPolls++;
+      if (micros() - c.writeStartUs > EEPROM_WRITE_CYCLE_MS * 2000UL) {
+        error = "Write cycle timeout";
+      }
+    } else if (c.busy && c.nextPage >= c.pages) {
+      c.busy = false;
+      r.ok = true;
+      r.ms = millis() - startMs;
+      c.done = true;
+      remaining--;
+      progressed = true;
+    } else {
+      uint16_t address = c.nextPage * EEPROM_PAGE_SIZE;
+      if (!startEEPROMPageWrite(bus, s.address, address, gangImages[s.image].data + address, EEPROM_PAGE_SIZE)) {
+        error = "Page write not acknowledged";
+      } else {
+        c.busy = true;
+        c.writeStartUs = micros();
+        c.nextPage++;
+        r.pages++;
+        progressed = true;
+      }
+    }
+    gangRelease(bus);
+
+    if (error) {
+      gangFail(c, r, error, startMs);
+      remaining--;
+    }
+  }
+}
+
+static void gangVerify(uint8_t index, GangSocketResult& r) {
+  const GangSocket& s = gangSockets[index];
+  const GangImage& img = gangImages[s.image];
+  uint8_t page[EEPROM_PAGE_SIZE];
+
+  for (uint16_t p = 0; p < r.pages; p++) {
+    uint16_t address = p * EEPROM_PAGE_SIZE;
+    i2c_lock(s.bus);
+    bool read = gangSelect(s) && readBlockFromEEPROMAt(s.bus, s.address, address, page, EEPROM_PAGE_SIZE);
+    gangRelease(s.bus);
+    if (read && memcmp(page, img.data + address, EEPROM_PAGE_SIZE) == 0) {
+      continue;
+    }
+    if (r.verifyErrors++ == 0) {
+      for (uint16_t b = 0; b < EEPROM_PAGE_SIZE; b++) {
+        if (!read || page[b] != img.data[address + b]) {
+          r.firstMismatch = address + b;
+          break;
+        }
+      }
+    }
+  }
+  if (r.verifyErrors) {
+    r.ok = false;
+    r.error = "Verify failed";
+  }
+}
+
+// Totals once the last bus job is done
+static void gangFinish() {
+  setWriteProtect(true);
+  gangReport.bytes = 0;
+  gangReport.success = true;
+  for (uint8_t i = 0; i < gangSocketCount; i++) {
+    gangReport.bytes += gangReport.results[i].pages * EEPROM_PAGE_SIZE;
+    gangReport.success &= gangReport.results[i].ok;
+  }
+  gangReport.bytesPerSec = gangReport.programMs ?
+      (uint32_t)((uint64_t)gangReport.bytes * 1000 / gangReport.programMs) : 0;
+  gangReport.running = false;
+  Serial.printf("Gang: %lu bytes on %u buses in %lu ms (%lu B/s), %s\n", (unsigned long)gangReport.bytes,
+                gangReport.buses, (unsigned long)gangReport.programMs, (unsigned long)gangReport.bytesPerSec,
+                gangReport.success ? "all sockets OK" : "failures");
+}
+
+static void gangJobDone() {
+  portENTER_CRITICAL(&gangJobMux);
+  bool last = --gangJobsLeft == 0;
+  portEXIT_CRITICAL(&gangJobMux);
+  if (last) {
+    gangFinish();
+  }
+}
+
+// Program, then verify, every socket on one bus; runs on that bus's worker
+static void gangBusJob(void* arg) {
+  uint8_t bus = (uint8_t)(uintptr_t)arg;
+  uint8_t remaining = 0;
+  for (uint8_t i = 0; i < gangSocketCount; i++) {
+    remaining += (gangSockets[i].bus == bus && !gangCursors[i].done);
+  }
+
+  i2c_setClock(bus, I2C_FAST_CLOCK_HZ);
+  unsigned long startMs = millis();
+  while (remaining > 0) {
+    bool progressed = false;
+    gangProgramPass(bus, startMs, remaining, progressed);
+    if (progressed) {
+      yield();
+    } else {
+      vTaskDelay(1);  // Every socket mid write cycle - let lower-priority tasks run
+    }
+  }
+  uint32_t programMs = millis() - startMs;
+
+  unsigned long verifyStart = millis();
+  if (gangVerifyRun) {
+    for (uint8_t i = 0; i < gangSocketCount; i++) {
+      if (gangSockets[i].bus == bus && gangReport.results[i].ok) {
+        gangVerify(i, gangReport.results[i]);
+      }
+    }
+  }
+  uint32_t verifyMs = millis() - verifyStart;
+  i2c_setClock(bus, 0);
+
+  portENTER_CRITICAL(&gangJobMux);
+  gangReport.programMs = max(gangReport.programMs, programMs);
+  gangReport.verifyMs = max(gangReport.verifyMs, verifyMs);
+  portEXIT_CRITICAL(&gangJobMux);
+  gangJobDone();
+}
+
+bool gang_start(bool verify) {
+  if (gang_isRunning()) {
+    return false;
+  }
+  memset(&gangReport, 0, sizeof(gangReport));
+  gangReport.sockets = gangSocketCount;
+  gangVerifyRun = verify;
+
+  bool busUsed[I2C_BUS_COUNT] = {};
+  for (uint8_t i = 0; i < gangSocketCount; i++) {
+    const GangImage& img = gangImages[gangSockets[i].image];
+    GangCursor& c = gangCursors[i];
+    memset(&c, 0, sizeof(c));
+    gangReport.results[i].firstMismatch = -1;
+    c.pages = (img.length + EEPROM_PAGE_SIZE - 1) / EEPROM_PAGE_SIZE;
+    if (!img.data || c.pages == 0) {
+      gangReport.results[i].error = "No image staged";
+      c.done = true;
+      continue;
+    }
+    busUsed[gangSockets[i].bus] = true;
+  }
+  for (uint8_t b = 0; b < I2C_BUS_COUNT; b++) {
+    gangReport.buses += busUsed[b];
+  }
+  if (gangReport.buses == 0) {
+    return false;
+  }
+
+  Serial.printf("Gang: programming %u sockets on %u buses\n", gangSocketCount, gangReport.buses);
+  setWriteProtect(false);
+  gangReport.running = true;
+  gangJobsLeft = gangReport.buses;
+  for (uint8_t b = 0; b < I2C_BUS_COUNT; b++) {
+    if (busUsed[b] && !i2c_submit(b, gangBusJob, (void*)(uintptr_t)b)) {
+      for (uint8_t i = 0; i < gangSocketCount; i++) {
+        if (gangSockets[i].bus == b && !gangCursors[i].done) {
+          gangFail(gangCursors[i], gangReport.results[i], "Bus worker busy", millis());
+        }
+      }
+      gangJobDone();
+    }
+  }
+  return true;
+}
+
+bool gang_isRunning() {
+  return gangReport.running;
+}
+
+const GangReport& gang_getReport() {
+  return gangReport;
+}
+
+bool gang_program(bool verify, GangReport& report) {
+  bool ok = gang_start(verify);
+  while (ok && gang_isRunning()) {
+    delay(1);
+  }
+  report = gangReport;
+  return ok && report.success;
+}
@@ -0,0 +1,70 @@
+#ifndef EEPROM_GANG_H
+#define EEPROM_GANG_H
+
+#include <Arduino.h>
+
+// Gang programming: several 24LC256 sockets written in one pass. Page
+// writes are round-robined across sockets, so while one chip runs its
+// internal write cycle the bus carries the next page for another chip;
+// each chip is ACK-polled only when its turn comes round again.
+//
+// Sockets are addressed directly (0x50-0x57) or through a TCA9548A mux
+// channel. Only one mux channel is enabled at a time, and none while a
+// direct socket is accessed, so a chip behind the mux may share an
+// address with a chip on the main bus.
+//
+// Each bus in use runs its sockets on its own worker task, so sockets on
+// both I2C controllers are programmed concurrently.
+
+#define GANG_MAX_SOCKETS 8
+#define GANG_MAX_IMAGES  4       // 32KB each, PSRAM when present
+#define GANG_MUX_NONE    -1      // Socket is on the main bus
+#define GANG_MUX_CHANNELS 8
+
+struct GangSocket {
+  uint8_t bus;              // I2C controller (see i2c_bus.h)
+  uint8_t address;          // 7-bit I2C address
+  int8_t muxChannel;        // TCA9548A channel or GANG_MUX_NONE
+  uint8_t image;            // Image slot programmed into this socket
+  bool present;             // Acknowledged when added
+};
+
+struct GangSocketResult {
+  bool ok;
+  uint16_t pages;           // Pages written
+  uint32_t ms;              // First page to last write cycle complete
+  uint32_t busyPolls;       // ACK polls that found the chip still busy
+  uint16_t verifyErrors;    // Pages that read back different
+  int32_t firstMismatch;    // -1 = none
+  const char* error;        // nullptr on success
+};
+
+struct GangReport {
+  bool success;
+  bool running;
+  uint8_t sockets;
+  uint8_t buses;            // Buses programmed in parallel
+  uint32_t bytes;           // Sum over all sockets
+  uint32_t programMs;       // Slowest bus
+  uint32_t verifyMs;
+  uint32_t bytesPerSec;     // Aggregate programming throughput
+  GangSocketResult results[GANG_MAX_SOCKETS];
+};
+
+// Image slots (unused tail 0xFF); pages up to the staged length are written
+bool gang_stageImage(uint8_t slot, const uint8_t* data, size_t length, size_t offset);
+uint32_t gang_getImageLength(uint8_t slot);
+void gang_clearImages();
+
+bool gang_addSocket(uint8_t bus, uint8_t address, int8_t muxChannel, uint8_t image);
+void gang_clearSockets();
+uint8_t gang_getSocketCount();
+GangSocket gang_getSocket(uint8_t index);
+
+// gang_start returns once the bus workers have the job; gang_program waits
+bool gang_start(bool verify);
+bool gang_isRunning();
+const GangReport& gang_getReport();
+bool gang_program(bool verify, GangReport& report);
+
+#endif // EEPROM_GANG_H
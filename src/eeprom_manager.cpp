@@ -1,4 +1,4 @@
-#include <Wire.h>
+#include "i2c_bus.h"
 #include "eeprom_manager.h"
 #include "dsp_helper.h"
 #include "config.h"
@@ -40,11 +40,13 @@ String i2c_log_get_all() {
   return out;
 }
 
-String i2c_scan() {
+String i2c_scan(uint8_t bus) {
   String out = "";
   for (uint8_t addr = 1; addr < 127; addr++) {
-    Wire.beginTransmission(addr);
-    int res = Wire.endTransmission();
+    i2c_lock(bus);
+    i2c_wire(bus).beginTransmission(addr);
+    int res = i2c_wire(bus).endTransmission();
+    i2c_unlock(bus);
     if (res == 0) {
       char buf[32];
       snprintf(buf, sizeof(buf), "0x%02X ", addr);
@@ -69,8 +71,7 @@ bool testWriteByte(uint16_t address, uint8_t value) {
 }
 
 void eeprom_begin() {
-  Wire.begin(SDA_PIN, SCL_PIN);
-  Wire.setClock(100000); // Standard 100kHz
+  i2c_init();
   pinMode(EEPROM_WP_PIN, OUTPUT);
   
   // Initialize WP pin to inactive state
@@ -84,8 +85,10 @@ void eeprom_begin() {
 }
 
 bool checkEEPROM() {
-  Wire.beginTransmission(EEPROM_I2C_ADDRESS);
-  int result = Wire.endTransmission();
+  uint8_t bus = i2c_lockDevice(I2C_DEVICE_EEPROM);
+  i2c_wire(bus).beginTransmission(EEPROM_I2C_ADDRESS);
+  int result = i2c_wire(bus).endTransmission();
+  i2c_unlock(bus);
   char msg[64];
   snprintf(msg, sizeof(msg), "EEPROM detect: addr=0x%02X, result=%d", EEPROM_I2C_ADDRESS, result);
   i2c_log_add(msg);
@@ -93,30 +96,37 @@ bool checkEEPROM() {
 }
 
 bool eraseEEPROM() {
+  return eraseEEPROMRange(0, EEPROM_SIZE);
+}
+
+// Erase [start, start + length), widened to whole pages
+bool eraseEEPROMRange(uint16_t start, uint32_t length) {
   uint8_t blankData[EEPROM_PAGE_SIZE];
   memset(blankData, 0xFF, EEPROM_PAGE_SIZE);
+
+  uint32_t first = start - (start % EEPROM_PAGE_SIZE);
+  uint32_t end = min((uint32_t)EEPROM_SIZE, (uint32_t)start + length);
+  end = ((end + EEPROM_PAGE_SIZE - 1) / EEPROM_PAGE_SIZE) * EEPROM_PAGE_SIZE;
   
   setWriteProtect(false);
   bool ok = true;
   
   // Setup progress tracking
   g_bytes_written = 0;
-  g_total_bytes_to_write = EEPROM_SIZE;
+  g_total_bytes_to_write = end - first;
   g_write_in_progress = true;
   
-  Serial.println("Starting EEPROM erase...");
+  Serial.printf("Starting EEPROM erase: 0x%04X-0x%04X...\n", first, end - 1);
   
-  for (uint16_t addr = 0; addr < EEPROM_SIZE; addr += EEPROM_PAGE_SIZE) {
+  for (uint32_t addr = first; addr < end; addr += EEPROM_PAGE_SIZE) {
     if (!writeToEEPROM(addr, blankData, EEPROM_PAGE_SIZE)) {
       ok = false;
       break;
     }
     
-    g_bytes_written += EEPROM_PAGE_SIZE;
-    
     // Progress feedback every 4KB
     if ((addr % 4096) == 0) {
-      Serial.printf("Erase progress: %d/%d bytes\n", g_bytes_written, EEPROM_SIZE);
+      Serial.printf("Erase progress: %d/%d bytes\n", g_bytes_written, end - first);
     }
     
     yield();
@@ -191,10 +201,16 @@ bool writeToEEPROM(uint16_t address, uint8_t data[], int length) {
       i2c_log_add(log_msg);
       #endif
 
+      // The page write holds the bus lock; the ACK poll below probes the
+      // same bus but takes the lock per probe, so the DSP side is not
+      // starved for a whole tWC
+      uint8_t bus = i2c_lockDevice(I2C_DEVICE_EEPROM);
+      TwoWire& wire = i2c_wire(bus);
+
       // Start I2C transmission
-      Wire.beginTransmission(EEPROM_I2C_ADDRESS);
-      Wire.write((uint8_t)((currentChunkAddr + chunkBytesWritten) >> 8));   // High address byte
-      Wire.write((uint8_t)((currentChunkAddr + chunkBytesWritten) & 0xFF)); // Low address byte
+      wire.beginTransmission(EEPROM_I2C_ADDRESS);
+      wire.write((uint8_t)((currentChunkAddr + chunkBytesWritten) >> 8));   // High address byte
+      wire.write((uint8_t)((currentChunkAddr + chunkBytesWritten) & 0xFF)); // Low address byte
       
       #if EEPROM_DEBUG
       // Log the data being written (first few bytes for debugging) - only in debug mode
@@ -210,9 +226,9 @@ bool writeToEEPROM(uint16_t address, uint8_t data[], int length) {
       }
       #endif
       
-      Wire.write(data + bytesWritten + chunkBytesWritten, bytesToWrite);
+      wire.write(data + bytesWritten + chunkBytesWritten, bytesToWrite);
       
-      int result = Wire.endTransmission();
+      int result = wire.endTransmission();
       
       #if EEPROM_DEBUG
       // Log I2C transmission result
@@ -221,6 +237,7 @@ bool writeToEEPROM(uint16_t address, uint8_t data[], int length) {
       #endif
       
       if (result != 0) {
+        i2c_unlock(bus);
         snprintf(log_msg, sizeof(log_msg), "I2C_WRITE_ERROR: result=%d at address 0x%04X", 
                  result, currentChunkAddr + chunkBytesWritten);
         Serial.println(log_msg);
@@ -235,11 +252,10 @@ bool writeToEEPROM(uint16_t address, uint8_t data[], int length) {
       unsigned long writeStartTime = millis();
       bool writeCompleted = false;
       
+      i2c_unlock(bus);
+
       while (millis() - writeStartTime < 50) {
-        Wire.beginTransmission(EEPROM_I2C_ADDRESS);
-        int pollResult = Wire.endTransmission();
-        
-        if (pollResult == 0) {
+        if (isEEPROMReady(bus, EEPROM_I2C_ADDRESS)) {
           writeCompleted = true;
           break;
         }
@@ -346,17 +362,136 @@ bool writeToEEPROM(uint16_t address, uint8_t data[], int length) {
   return true;
 }
 
+// Start a page write on any 24LC256 on the given bus; the chip is busy
+// for up to tWC afterwards. Data must not cross a page boundary.
+bool startEEPROMPageWrite(uint8_t bus, uint8_t device, uint16_t address, const uint8_t* data, size_t length) {
+  if (length == 0 || (address % EEPROM_PAGE_SIZE) + length > EEPROM_PAGE_SIZE ||
+      address + length > EEPROM_SIZE) {
+    return false;
+  }
+
+  TwoWire& wire = i2c_wire(bus);
+  i2c_lock(bus);
+  wire.beginTransmission(device);
+  wire.write((uint8_t)(address >> 8));
+  wire.write((uint8_t)(address & 0xFF));
+  wire.write(data, length);
+  bool ok = wire.endTransmission() == 0;
+  i2c_unlock(bus);
+  return ok;
+}
+
+// ACK poll: a chip in its internal write cycle does not acknowledge
+bool isEEPROMReady(uint8_t bus, uint8_t device) {
+  i2c_lock(bus);
+  i2c_wire(bus).beginTransmission(device);
+  bool ok = i2c_wire(bus).endTransmission() == 0;
+  i2c_unlock(bus);
+  return ok;
+}
+
+// Whole page in one transaction, then ACK-poll at EEPROM_ACK_POLL_US
+// granularity so the next page starts as soon as the write cycle ends.
+// No logging or write-protect handling - the caller owns both. The lock
+// is held for the write and for each probe, never across the wait.
+bool writeEEPROMPage(uint16_t address, const uint8_t* data, size_t length) {
+  uint8_t bus = i2c_lockDevice(I2C_DEVICE_EEPROM);
+  bool ok = startEEPROMPageWrite(bus, EEPROM_I2C_ADDRESS, address, data, length);
+  i2c_unlock(bus);
+
+  unsigned long startTime = micros();
+  bool ready = false;
+  while (ok && !ready && micros() - startTime < EEPROM_WRITE_CYCLE_MS * 2000UL) {
+    delayMicroseconds(EEPROM_ACK_POLL_US);
+    ready = isEEPROMReady(bus, EEPROM_I2C_ADDRESS);
+  }
+  return ready;
+}
+
+// Estimated time for writeToEEPROM(address, length), following the same
+// chunk/page/transfer split: each transfer costs its bus time (START,
+// device address, two address bytes, data; 9 clocks per byte) plus one
+// ACK-polled internal write cycle.
+uint32_t estimateEEPROMWriteTimeUs(uint16_t address, int length) {
+  const int WRITE_CHUNK_SIZE = 32;
+  uint32_t us = 0;
+  int done = 0;
+
+  while (done < length) {
+    int chunkSize = min(WRITE_CHUNK_SIZE, length - done);
+    int chunkDone = 0;
+    while (chunkDone < chunkSize) {
+      int pageOffset = (address + done + chunkDone) % EEPROM_PAGE_SIZE;
+      int bytesToWrite = min(EEPROM_PAGE_SIZE - pageOffset, I2C_MAX_DATA_PER_XFER);
+      bytesToWrite = min(bytesToWrite, chunkSize - chunkDone);
+
+      us += (uint32_t)(bytesToWrite + 3) * 9 * 1000000UL / I2C_CLOCK_HZ;
+      us += EEPROM_WRITE_CYCLE_MS * 1000UL;
+      chunkDone += bytesToWrite;
+    }
+    done += chunkSize;
+  }
+  return us;
+}
+
 uint8_t readFromEEPROM(uint16_t address) {
-  Wire.beginTransmission(EEPROM_I2C_ADDRESS);
-  Wire.write((uint8_t)(address >> 8));
-  Wire.write((uint8_t)(address & 0xFF));
-  Wire.endTransmission();
+  uint8_t bus = i2c_lockDevice(I2C_DEVICE_EEPROM);
+  TwoWire& wire = i2c_wire(bus);
+  wire.beginTransmission(EEPROM_I2C_ADDRESS);
+  wire.write((uint8_t)(address >> 8));
+  wire.write((uint8_t)(address & 0xFF));
+  wire.endTransmission();
   
-  Wire.requestFrom(EEPROM_I2C_ADDRESS, 1);
-  if (Wire.available()) {
-    return Wire.read();
+  wire.requestFrom(EEPROM_I2C_ADDRESS, 1);
+  uint8_t value = 0xFF; // Returned if the read fails
+  if (wire.available()) {
+    value = wire.read();
   }
-  return 0xFF; // Return 0xFF if read fails
+  i2c_unlock(bus);
+  return value;
+}
+
+// Sequential read: one addressed transaction per I2C_MAX_DATA_PER_XFER
+// bytes instead of one per byte. Unread bytes are returned as 0xFF.
+bool readBlockFromEEPROM(uint16_t address, uint8_t* buffer, size_t length) {
+  uint8_t bus = i2c_lockDevice(I2C_DEVICE_EEPROM);
+  bool ok = readBlockFromEEPROMAt(bus, EEPROM_I2C_ADDRESS, address, buffer, length);
+  i2c_unlock(bus);
+  return ok;
+}
+
+bool readBlockFromEEPROMAt(uint8_t bus, uint8_t device, uint16_t address, uint8_t* buffer, size_t length) {
+  if (address + length > EEPROM_SIZE) {
+    return false;
+  }
+
+  TwoWire& wire = i2c_wire(bus);
+  size_t done = 0;
+  while (done < length) {
+    uint8_t n = (uint8_t)min((size_t)I2C_MAX_DATA_PER_XFER, length - done);
+    uint16_t addr = address + done;
+
+    i2c_lock(bus);
+    wire.beginTransmission(device);
+    wire.write((uint8_t)(addr >> 8));
+    wire.write((uint8_t)(addr & 0xFF));
+    if (wire.endTransmission() != 0) {
+      i2c_unlock(bus);
+      memset(buffer + done, 0xFF, length - done);
+      return false;
+    }
+
+    uint8_t got = wire.requestFrom(device, n);
+    for (uint8_t i = 0; i < n; i++) {
+      buffer[done + i] = (i < got && wire.available()) ? wire.read() : 0xFF;
+    }
+    i2c_unlock(bus);
+    if (got != n) {
+      return false;
+    }
+    done += n;
+  }
+  return true;
 }
 
 void setWriteProtect(bool enable) {
@@ -10,8 +10,15 @@
 void eeprom_begin();
 bool checkEEPROM();
 bool eraseEEPROM();
+bool eraseEEPROMRange(uint16_t start, uint32_t length);
 bool writeToEEPROM(uint16_t address, uint8_t data[], int length);
+bool writeEEPROMPage(uint16_t address, const uint8_t* data, size_t length);
+bool startEEPROMPageWrite(uint8_t bus, uint8_t device, uint16_t address, const uint8_t* data, size_t length);
+bool isEEPROMReady(uint8_t bus, uint8_t device);
 uint8_t readFromEEPROM(uint16_t address);
+bool readBlockFromEEPROM(uint16_t address, uint8_t* buffer, size_t length);
+bool readBlockFromEEPROMAt(uint8_t bus, uint8_t device, uint16_t address, uint8_t* buffer, size_t length);
+uint32_t estimateEEPROMWriteTimeUs(uint16_t address, int length);
 
 // Write Protection Control
 void setWriteProtect(bool enable);
@@ -30,7 +37,7 @@ bool getVerificationEnabled();
 // I2C Diagnostics
 void i2c_log_add(const char* msg);
 String i2c_log_get_all();
-String i2c_scan();
+String i2c_scan(uint8_t bus);
 bool testWriteByte(uint16_t address, uint8_t value);
 // Add to eeprom_manager.h
 bool verifyEEPROMRange(uint16_t startAddr, uint16_t length, uint8_t expectedData[]);
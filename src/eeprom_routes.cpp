@@ -1,6 +1,11 @@
 #include "eeprom_routes.h"
 #include "config.h"
 #include "eeprom_manager.h"
+#include "selfboot_image.h"
+#include "eeprom_emulator.h"
+#include "eeprom_gang.h"
+#include "i2c_bus.h"
+#include "dsp_helper.h"
 #include <ArduinoJson.h>
 #include <WebServer.h>
 #include <Wire.h>
@@ -20,11 +25,51 @@ void handleDetect() {
   sendJson(200, doc);
 }
 
+// Used region of the stored self-boot image, or the whole chip when
+// ?full=1 is given or the EEPROM holds no valid image.
+static uint32_t usedEEPROMRegion(SelfBootImageInfo& info) {
+  if (g_server->arg("full") == "1") {
+    memset(&info, 0, sizeof(info));
+    return EEPROM_SIZE;
+  }
+  info = selfboot_analyzeEEPROM();
+  return selfboot_usedRegion(info);
+}
+
 void handleErase() {
   Serial.println("EEPROM erase");
   JsonDocument doc;
-  doc["success"] = eraseEEPROM();
-  doc["message"] = doc["success"] ? "EEPROM erased" : "Erase failed";
+  SelfBootImageInfo info;
+  uint32_t length = usedEEPROMRegion(info);
+  doc["success"] = eraseEEPROMRange(0, length);
+  doc["erasedBytes"] = length;
+  doc["message"] = doc["success"] ?
+    (length < EEPROM_SIZE ? "EEPROM image region erased" : "EEPROM erased") :
+    "Erase failed";
+  sendJson(200, doc);
+}
+
+void handleImageInfo() {
+  Serial.println("EEPROM self-boot image info");
+  JsonDocument doc;
+  unsigned long startTime = millis();
+  SelfBootImageInfo info = selfboot_analyzeEEPROM();
+
+  doc["success"] = info.valid;
+  doc["complete"] = info.complete;
+  doc["imageLength"] = info.imageLength;
+  doc["usedRegion"] = selfboot_usedRegion(info);
+  doc["writeMessages"] = info.writeMessages;
+  doc["delayMessages"] = info.delayMessages;
+  doc["nopMessages"] = info.nopMessages;
+  doc["paramBytes"] = info.paramBytes;
+  doc["programBytes"] = info.programBytes;
+  doc["registerBytes"] = info.registerBytes;
+  if (info.error != nullptr) {
+    doc["error"] = info.error;
+    doc["errorOffset"] = info.errorOffset;
+  }
+  doc["analyzeMs"] = millis() - startTime;
   sendJson(200, doc);
 }
 
@@ -100,16 +145,23 @@ void handleRead() {
 
 void handleDump() {
   Serial.println("EEPROM dump");
-  g_server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  SelfBootImageInfo info;
+  uint32_t length = usedEEPROMRegion(info);
+
+  g_server->setContentLength(length);
   g_server->send(200, "application/octet-stream", "");
 
   uint8_t buf[64];
-  for (uint16_t addr = 0; addr < EEPROM_SIZE; addr += 64) {
-    for (uint8_t i = 0; i < 64; i++) {
-      buf[i] = readFromEEPROM(addr + i);
+  for (uint32_t addr = 0; addr < length; addr += sizeof(buf)) {
+    size_t n = min((uint32_t)sizeof(buf), length - addr);
+    // Headers are gone already - keep the length, pad unread bytes as
+    // erased, and note the failure on the console
+    if (!readBlockFromEEPROM(addr, buf, n)) {
+      memset(buf, 0xFF, n);
+      Serial.printf("EEPROM dump: read failed at 0x%04lX\n", (unsigned long)addr);
     }
-    g_server->sendContent((const char*)buf, 64);
-    delay(1);
+    g_server->sendContent((const char*)buf, n);
+    yield();
   }
 }
 
@@ -234,11 +286,20 @@ void handleVerifyRange() {
   int errors = 0;
   String errorDetails = "";
 
+  // Read the whole range with sequential block reads up front
+  uint8_t actualData[256];
+  if (!readBlockFromEEPROM(startAddr, actualData, min((uint32_t)length, (uint32_t)(EEPROM_SIZE - startAddr)))) {
+    doc["success"] = false;
+    doc["message"] = "EEPROM read failed";
+    sendJson(500, doc);
+    return;
+  }
+
   for (uint16_t i = 0; i < length; i++) {
     // Extract expected byte efficiently
     char hexByte[3] = { expectedHex[i * 2], expectedHex[i * 2 + 1], '\0' };
     uint8_t expected = strtol(hexByte, NULL, 16);
-    uint8_t actual = readFromEEPROM(startAddr + i);
+    uint8_t actual = (startAddr + i < EEPROM_SIZE) ? actualData[i] : 0xFF;
 
     if (expected != actual) {
       if (errors < 3) { // Very limited error logging
@@ -340,15 +401,252 @@ void handleStressTest() {
   sendJson(200, doc);
 }
 
+// EEPROM EMULATOR - stage an image in RAM and serve it to the DSP over Wire1
+static uint32_t g_emu_stage_offset = 0;
+static bool g_emu_stage_ok = false;
+
+void handleEmuStageUpload() {
+  HTTPUpload& upload = g_server->upload();
+
+  if (upload.status == UPLOAD_FILE_START) {
+    g_emu_stage_offset = 0;
+    g_emu_stage_ok = true;
+  } else if (upload.status == UPLOAD_FILE_WRITE && g_emu_stage_ok) {
+    g_emu_stage_ok = eeprom_emu_stage(upload.buf, upload.currentSize, g_emu_stage_offset);
+    g_emu_stage_offset += upload.currentSize;
+  } else if (upload.status == UPLOAD_FILE_ABORTED) {
+    g_emu_stage_ok = false;
+  }
+}
+
+static void addEmuStats(JsonDocument& doc) {
+  const EepromEmuStats& stats = eeprom_emu_getStats();
+  doc["active"] = stats.active;
+  doc["imageLength"] = stats.imageLength;
+  doc["addressSets"] = stats.addressSets;
+  doc["readRequests"] = stats.readRequests;
+  doc["bytesServed"] = stats.bytesServed;
+  doc["bytesWritten"] = stats.bytesWritten;
+  doc["pointer"] = stats.pointer;
+}
+
+// Upload a binary image, or ?from=eeprom to copy the physical chip
+void handleEmuStage() {
+  JsonDocument doc;
+  bool ok = (g_server->arg("from") == "eeprom") ? eeprom_emu_stageFromEEPROM() : g_emu_stage_ok;
+  g_emu_stage_ok = false;
+
+  doc["success"] = ok;
+  doc["message"] = ok ? "Image staged for emulation" : "Staging failed";
+  addEmuStats(doc);
+  sendJson(ok ? 200 : 500, doc);
+}
+
+// {"enabled":true, "boot":true} - start the slave and optionally self-boot
+// the DSP from the staged image
+void handleEmuControl() {
+  JsonDocument req;
+  JsonDocument doc;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  if ((req["enabled"] | false) && (req["boot"] | false) && !dsp_canSelfBoot()) {
+    doc["success"] = false;
+    doc["message"] = "No reset pin configured - the DSP cannot boot from the emulator";
+    sendJson(400, doc);
+    return;
+  }
+
+  bool ok = true;
+  if (req["enabled"] | false) {
+    ok = eeprom_emu_start();
+    if (ok && (req["boot"] | false)) {
+      unsigned long bootStart = millis();
+      ok = dsp_selfBoot();
+      doc["bootMs"] = millis() - bootStart;
+    }
+  } else {
+    eeprom_emu_stop();
+  }
+
+  doc["success"] = ok;
+  addEmuStats(doc);
+  sendJson(ok ? 200 : 500, doc);
+}
+
+void handleEmuStatus() {
+  JsonDocument doc;
+  doc["success"] = true;
+  addEmuStats(doc);
+  sendJson(200, doc);
+}
+
+// Replay the master read sequence against the emulator core
+void handleEmuSelfTest() {
+  JsonDocument doc;
+  String report;
+  bool ok = eeprom_emu_selfTest(report);
+  doc["success"] = ok;
+  doc["results"] = report;
+  sendJson(200, doc);
+}
+
+// GANG PROGRAMMING - images staged per slot, sockets programmed interleaved
+static uint32_t g_gang_stage_offset = 0;
+static bool g_gang_stage_ok = false;
+
+void handleGangImageUpload() {
+  HTTPUpload& upload = g_server->upload();
+  uint8_t slot = g_server->arg("slot").toInt();
+
+  if (upload.status == UPLOAD_FILE_START) {
+    g_gang_stage_offset = 0;
+    g_gang_stage_ok = true;
+  } else if (upload.status == UPLOAD_FILE_WRITE && g_gang_stage_ok) {
+    g_gang_stage_ok = gang_stageImage(slot, upload.buf, upload.currentSize, g_gang_stage_offset);
+    g_gang_stage_offset += upload.currentSize;
+  } else if (upload.status == UPLOAD_FILE_ABORTED) {
+    g_gang_stage_ok = false;
+  }
+}
+
+// Binary image upload to ?slot=N
+void handleGangImage() {
+  JsonDocument doc;
+  uint8_t slot = g_server->arg("slot").toInt();
+  bool ok = g_gang_stage_ok;
+  g_gang_stage_ok = false;
+
+  doc["success"] = ok;
+  doc["slot"] = slot;
+  doc["length"] = gang_getImageLength(slot);
+  doc["message"] = ok ? "Image staged" : "Staging failed";
+  sendJson(ok ? 200 : 500, doc);
+}
+
+static void addGangReport(JsonDocument& doc, const GangReport& report) {
+  doc["running"] = report.running;
+  doc["buses"] = report.buses;
+  doc["bytes"] = report.bytes;
+  doc["programMs"] = report.programMs;
+  doc["verifyMs"] = report.verifyMs;
+  doc["bytesPerSec"] = report.bytesPerSec;
+  JsonArray results = doc["results"].to<JsonArray>();
+  for (uint8_t i = 0; i < report.sockets; i++) {
+    const GangSocketResult& r = report.results[i];
+    JsonObject o = results.add<JsonObject>();
+    o["addr"] = gang_getSocket(i).address;
+    o["ok"] = r.ok;
+    o["pages"] = r.pages;
+    o["ms"] = r.ms;
+    o["busyPolls"] = r.busyPolls;
+    o["verifyErrors"] = r.verifyErrors;
+    if (r.firstMismatch >= 0) o["firstMismatch"] = r.firstMismatch;
+    if (r.error) o["error"] = r.error;
+  }
+}
+
+// Sockets, staged images and the last (or running) program report
+void handleGangStatus() {
+  JsonDocument doc;
+  doc["success"] = true;
+  JsonArray images = doc["images"].to<JsonArray>();
+  for (uint8_t i = 0; i < GANG_MAX_IMAGES; i++) {
+    images.add(gang_getImageLength(i));
+  }
+  JsonArray sockets = doc["sockets"].to<JsonArray>();
+  for (uint8_t i = 0; i < gang_getSocketCount(); i++) {
+    GangSocket s = gang_getSocket(i);
+    JsonObject o = sockets.add<JsonObject>();
+    o["bus"] = s.bus;
+    o["addr"] = s.address;
+    o["mux"] = s.muxChannel;
+    o["image"] = s.image;
+    o["present"] = s.present;
+  }
+  addGangReport(doc, gang_getReport());
+  sendJson(200, doc);
+}
+
+// Replace the sockets: {"sockets":[{"bus":0,"addr":80,"mux":-1,"image":0}, ...]}
+void handleGangSockets() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+  if (gang_isRunning()) {
+    doc["success"] = false;
+    doc["message"] = "Gang program in progress";
+    sendJson(409, doc);
+    return;
+  }
+
+  gang_clearSockets();
+  for (JsonObject s : req["sockets"].as<JsonArray>()) {
+    if (!gang_addSocket(s["bus"] | EEPROM_BUS, s["addr"] | EEPROM_I2C_ADDRESS,
+                        s["mux"] | GANG_MUX_NONE, s["image"] | 0)) {
+      doc["success"] = false;
+      doc["message"] = "Invalid socket, inactive bus or too many sockets";
+      sendJson(400, doc);
+      return;
+    }
+  }
+  handleGangStatus();
+}
+
+// Program every socket from its image slot; ?verify=0 skips the read-back.
+// ?async=1 returns at once - poll GET /gang - so the loop stays free for
+// DSP control while the bus workers program.
+void handleGangProgram() {
+  JsonDocument doc;
+  bool verify = g_server->arg("verify") != "0";
+
+  if (g_server->arg("async") == "1") {
+    bool ok = gang_start(verify);
+    doc["success"] = ok;
+    doc["message"] = ok ? "Gang program started" : "Already running or nothing to program";
+    addGangReport(doc, gang_getReport());
+    sendJson(ok ? 202 : 409, doc);
+    return;
+  }
+
+  GangReport report;
+  bool ok = gang_program(verify, report);
+  doc["success"] = ok;
+  addGangReport(doc, report);
+  sendJson(ok ? 200 : 500, doc);
+}
+
 void register_eeprom_routes(WebServer &server) {
   // EEPROM operations
   server.on("/detect", HTTP_GET, handleDetect);
   server.on("/erase", HTTP_POST, handleErase);
   server.on("/read", HTTP_GET, handleRead);
   server.on("/dump", HTTP_GET, handleDump);
+  server.on("/image_info", HTTP_GET, handleImageInfo);
 
   // Enhanced EEPROM operations
   server.on("/read_range", HTTP_GET, handleReadRange);
   server.on("/verify_range", HTTP_POST, handleVerifyRange);
   server.on("/stress_test", HTTP_POST, handleStressTest);
+
+  // EEPROM emulator
+  server.on("/emu/stage", HTTP_POST, handleEmuStage, handleEmuStageUpload);
+  server.on("/emu", HTTP_POST, handleEmuControl);
+  server.on("/emu", HTTP_GET, handleEmuStatus);
+  server.on("/emu/selftest", HTTP_GET, handleEmuSelfTest);
+
+  // Gang programming
+  server.on("/gang/image", HTTP_POST, handleGangImage, handleGangImageUpload);
+  server.on("/gang", HTTP_GET, handleGangStatus);
+  server.on("/gang/sockets", HTTP_POST, handleGangSockets);
+  server.on("/gang/program", HTTP_POST, handleGangProgram);
 }
\ No newline at end of file
@@ -8,9 +8,20 @@ void handleDetect();
 void handleErase();
 void handleRead();
 void handleDump();
+void handleImageInfo();
 void handleReadRange();
 void handleVerifyRange();
 void handleStressTest();
+void handleEmuStageUpload();
+void handleEmuStage();
+void handleEmuControl();
+void handleEmuStatus();
+void handleEmuSelfTest();
+void handleGangImageUpload();
+void handleGangImage();
+void handleGangStatus();
+void handleGangSockets();
+void handleGangProgram();
 
 // EEPROM routes registration
 void register_eeprom_routes(WebServer &server);
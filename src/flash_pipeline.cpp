@@ -0,0 +1,246 @@
+#include "flash_pipeline.h"
+#include "config.h"
+#include "dsp_helper.h"
+#include "dsp_boot_verify.h"
+#include "eeprom_manager.h"
+#include "selfboot_image.h"
+#include "i2c_bus.h"
+
+#define PIPELINE_PAGES (EEPROM_SIZE / EEPROM_PAGE_SIZE)
+
+static const char* const kPhaseNames[PIPELINE_PHASE_COUNT] = {
+  "analyze", "compare", "erase", "program", "verify", "boot", "dsp_verify"
+};
+
+static uint8_t* pipeImage = nullptr;
+static uint32_t pipeReceived = 0;
+static bool pipeOverflow = false;
+static unsigned long pipeStartMs = 0;
+static uint8_t pipeDirty[PIPELINE_PAGES / 8];  // Pages that differ from the image
+
+static bool pageDirty(uint16_t page) {
+  return pipeDirty[page >> 3] & (1 << (page & 7));
+}
+
+bool pipeline_begin() {
+  pipeline_end();
+  if (ESP.getFreeHeap() < EEPROM_SIZE + MAX_HEAP_REQUIRED) {
+    Serial.println("Pipeline: not enough heap for the image buffer");
+    return false;
+  }
+  pipeImage = (uint8_t*)malloc(EEPROM_SIZE);
+  if (!pipeImage) {
+    return false;
+  }
+  memset(pipeImage, 0xFF, EEPROM_SIZE);
+  pipeReceived = 0;
+  pipeOverflow = false;
+  pipeStartMs = millis();
+  return true;
+}
+
+bool pipeline_feed(const uint8_t* data, size_t length) {
+  if (!pipeImage) {
+    return false;
+  }
+  size_t n = min((size_t)(EEPROM_SIZE - pipeReceived), length);
+  memcpy(pipeImage + pipeReceived, data, n);
+  pipeReceived += n;
+  pipeOverflow |= (n < length);
+  return !pipeOverflow;
+}
+
+void pipeline_end() {
+  free(pipeImage);
+  pipeImage = nullptr;
+}
+
+const char* pipeline_phaseName(PipelinePhase phase) {
+  return phase < PIPELINE_PHASE_COUNT ? kPhaseNames[phase] : "unknown";
+}
+
+// Parse the uploaded image; blank its margin; find the old image extent
+static bool phaseAnalyze(PipelineReport& report, PipelinePhaseResult& r, uint32_t& oldUsed) {
+  selfboot_begin();
+  selfboot_feed(pipeImage, pipeReceived);
+  SelfBootImageInfo info = selfboot_getInfo();
+  if (!info.valid || pipeOverflow) {
+    report.error = pipeOverflow ? "Image larger than EEPROM" :
+                   (info.error ? info.error : "No END message in image");
+    return false;
+  }
+  report.imageLength = info.imageLength;
+  report.usedRegion = selfboot_usedRegion(info);
+  memset(pipeImage + info.imageLength, 0xFF, report.usedRegion - info.imageLength);
+
+  SelfBootImageInfo old = selfboot_analyzeEEPROM();
+  oldUsed = old.valid ? selfboot_usedRegion(old) : 0;
+  r.bytes = pipeReceived;
+  return true;
+}
+
+// Mark pages of the used region whose EEPROM content differs
+static bool phaseCompare(const PipelineOptions& options, PipelineReport& report, PipelinePhaseResult& r) {
+  uint8_t page[EEPROM_PAGE_SIZE];
+  memset(pipeDirty, 0, sizeof(pipeDirty));
+
+  for (uint32_t addr = 0; addr < report.usedRegion; addr += EEPROM_PAGE_SIZE) {
+    size_t n = min((uint32_t)EEPROM_PAGE_SIZE, report.usedRegion - addr);
+    bool differs = options.force;
+    if (!differs) {
+      if (!readBlockFromEEPROM(addr, page, n)) {
+        report.error = "EEPROM read failed";
+        return false;
+      }
+      r.bytes += n;
+      differs = memcmp(page, pipeImage + addr, n) != 0;
+    }
+    if (differs) {
+      uint16_t p = addr / EEPROM_PAGE_SIZE;
+      pipeDirty[p >> 3] |= (1 << (p & 7));
+      report.pagesChanged++;
+    }
+    yield();
+  }
+  return true;
+}
+
+// Blank non-blank pages between the new image and the end of the old one
+static bool phaseErase(uint32_t start, uint32_t end, PipelineReport& report, PipelinePhaseResult& r) {
+  uint8_t page[EEPROM_PAGE_SIZE];
+  uint8_t blank[EEPROM_PAGE_SIZE];
+  memset(blank, 0xFF, sizeof(blank));
+
+  for (uint32_t addr = start; addr < end; addr += EEPROM_PAGE_SIZE) {
+    if (!readBlockFromEEPROM(addr, page, EEPROM_PAGE_SIZE)) {
+      report.error = "EEPROM read failed";
+      return false;
+    }
+    if (memcmp(page, blank, EEPROM_PAGE_SIZE) == 0) {
+      continue;
+    }
+    if (!writeEEPROMPage(addr, blank, EEPROM_PAGE_SIZE)) {
+      report.error = "EEPROM erase failed";
+      return false;
+    }
+    r.bytes += EEPROM_PAGE_SIZE;
+    report.pagesErased++;
+    yield();
+  }
+  return true;
+}
+
+// Write changed pages (program) or read them back and compare (verify)
+static bool phaseChangedPages(bool program, PipelineReport& report, PipelinePhaseResult& r) {
+  uint8_t page[EEPROM_PAGE_SIZE];
+
+  for (uint32_t addr = 0; addr < report.usedRegion; addr += EEPROM_PAGE_SIZE) {
+    if (!pageDirty(addr / EEPROM_PAGE_SIZE)) {
+      continue;
+    }
+    size_t n = min((uint32_t)EEPROM_PAGE_SIZE, report.usedRegion - addr);
+    if (program) {
+      if (!writeEEPROMPage(addr, pipeImage + addr, n)) {
+        report.error = "EEPROM write failed";
+        return false;
+      }
+    } else if (!readBlockFromEEPROM(addr, page, n) || memcmp(page, pipeImage + addr, n) != 0) {
+      report.error = "EEPROM verify failed";
+      return false;
+    }
+    r.bytes += n;
+    yield();
+  }
+  return true;
+}
+
+bool pipeline_run(const PipelineOptions& options, PipelineProgressFn progress, PipelineReport& report) {
+  memset(&report, 0, sizeof(report));
+  report.uploadMs = millis() - pipeStartMs;
+  if (!pipeImage || pipeReceived == 0) {
+    report.error = "No image received";
+    return false;
+  }
+
+  unsigned long runStart = millis();
+  uint32_t oldUsed = 0;
+  bool ok = true;
+
+  // EEPROM phases at the fast clock; page writes are bound by tWC anyway.
+  // The base clock goes back on the bus that was sped up.
+  uint8_t eepromBus = EEPROM_BUS;
+  i2c_setClock(eepromBus, I2C_FAST_CLOCK_HZ);
+  for (int p = 0; p < PIPELINE_PHASE_COUNT && ok; p++) {
+    PipelinePhaseResult& r = report.phases[p];
+    unsigned long phaseStart = millis();
+    r.run = true;
+
+    switch (p) {
+      case PIPELINE_ANALYZE:
+        ok = phaseAnalyze(report, r, oldUsed);
+        break;
+      case PIPELINE_COMPARE:
+        ok = phaseCompare(options, report, r);
+        break;
+      case PIPELINE_ERASE: {
+        uint32_t start = ((report.usedRegion + EEPROM_PAGE_SIZE - 1) / EEPROM_PAGE_SIZE) * EEPROM_PAGE_SIZE;
+        uint32_t end = options.fullErase ? EEPROM_SIZE : min((uint32_t)EEPROM_SIZE, oldUsed);
+        r.skipped = (start >= end);
+        if (!r.skipped) {
+          setWriteProtect(false);
+          ok = phaseErase(start, end, report, r);
+          setWriteProtect(true);
+        }
+        break;
+      }
+      case PIPELINE_PROGRAM:
+      case PIPELINE_VERIFY:
+        r.skipped = (report.pagesChanged == 0);
+        if (!r.skipped) {
+          if (p == PIPELINE_PROGRAM) setWriteProtect(false);
+          ok = phaseChangedPages(p == PIPELINE_PROGRAM, report, r);
+          if (p == PIPELINE_PROGRAM) setWriteProtect(true);
+        }
+        if (p == PIPELINE_VERIFY) {
+          i2c_setClock(eepromBus, 0);
+        }
+        break;
+      case PIPELINE_BOOT:
+        // Without /RESET the DSP keeps its old program; verifying it against
+        // the new image would only report a false mismatch
+        r.skipped = !options.boot || !dsp_canSelfBoot();
+        if (!r.skipped && !dsp_selfBoot()) {
+          ok = false;
+          report.error = "DSP self-boot did not complete";
+        }
+        report.dspReloaded = !r.skipped && ok;
+        break;
+      case PIPELINE_DSP_VERIFY:
+        r.skipped = !report.dspReloaded || !options.verifyDsp;
+        if (!r.skipped) {
+          DSPBootVerifyResult v = dsp_boot_verify_run();
+          r.bytes = v.bytesCompared;
+          if (!v.ok) {
+            ok = false;
+            report.error = v.error ? v.error : "DSP RAM does not match the image";
+          }
+        }
+        break;
+    }
+
+    r.ok = ok;
+    r.ms = millis() - phaseStart;
+    if (progress) {
+      progress((PipelinePhase)p, report);
+    }
+  }
+  i2c_setClock(eepromBus, 0);
+  setWriteProtect(true);
+
+  report.success = ok;
+  report.totalMs = millis() - runStart;
+  Serial.printf("Pipeline: %s in %lu ms (%u pages changed, %u erased)\n",
+                ok ? "done" : report.error, (unsigned long)report.totalMs,
+                report.pagesChanged, report.pagesErased);
+  return ok;
+}
@@ -0,0 +1,59 @@
+#ifndef FLASH_PIPELINE_H
+#define FLASH_PIPELINE_H
+
+#include <Arduino.h>
+
+// One-shot production flash of a binary self-boot image:
+// analyze -> compare -> erase -> program -> verify -> boot -> DSP verify.
+// Phases with nothing to do are skipped (unchanged pages are not written).
+enum PipelinePhase {
+  PIPELINE_ANALYZE,
+  PIPELINE_COMPARE,
+  PIPELINE_ERASE,
+  PIPELINE_PROGRAM,
+  PIPELINE_VERIFY,
+  PIPELINE_BOOT,
+  PIPELINE_DSP_VERIFY,
+  PIPELINE_PHASE_COUNT
+};
+
+struct PipelinePhaseResult {
+  bool run;                 // Phase was reached
+  bool skipped;             // Nothing to do
+  bool ok;
+  uint32_t ms;
+  uint32_t bytes;           // Bytes read or written by the phase
+};
+
+struct PipelineOptions {
+  bool boot;                // Self-boot the DSP after programming
+  bool verifyDsp;           // Compare DSP RAM against the image after boot
+  bool fullErase;           // Blank the whole chip past the image
+  bool force;               // Program every page even if unchanged
+};
+
+struct PipelineReport {
+  PipelinePhaseResult phases[PIPELINE_PHASE_COUNT];
+  bool success;
+  uint32_t uploadMs;        // Image transfer time, before the phases
+  uint32_t imageLength;
+  uint32_t usedRegion;      // Image plus blank-check margin
+  uint16_t pagesChanged;
+  uint16_t pagesErased;
+  bool dspReloaded;         // Boot phase reloaded the DSP (false: skipped or no reset pin)
+  uint32_t totalMs;         // Phases only
+  const char* error;        // nullptr on success
+};
+
+// Called after each phase so the caller can stream progress
+typedef void (*PipelineProgressFn)(PipelinePhase phase, const PipelineReport& report);
+
+// Image intake during the upload (buffer of EEPROM_SIZE on the heap)
+bool pipeline_begin();
+bool pipeline_feed(const uint8_t* data, size_t length);
+void pipeline_end();
+
+bool pipeline_run(const PipelineOptions& options, PipelineProgressFn progress, PipelineReport& report);
+const char* pipeline_phaseName(PipelinePhase phase);
+
+#endif // FLASH_PIPELINE_H
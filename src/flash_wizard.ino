@@ -8,6 +8,10 @@
 #include "dsp_helper.h"
 #include "hex_parser.h"
 #include "web_routes.h"
+#include "param_queue.h"
+#include "param_map.h"
+#include "level_stream.h"
+#include "sigma_tcp.h"
 
 // WiFi settings
 const char* ap_ssid = "EEPROM_Programmer";
@@ -22,6 +26,7 @@ void setup() {
   eeprom_begin();
   dsp_init();
   hex_begin();
+  param_map_load();
 
   Serial.println("\n=== EEPROM Programmer Starting ===");
   Serial.printf("Free Heap: %d bytes\n", ESP.getFreeHeap());
@@ -58,6 +63,7 @@ void setup() {
   // Register web routes and start server
   register_web_routes(server);
   server.begin();
+  sigma_tcp_begin();
   
   Serial.println("✓ HTTP server started");
   Serial.println("✓ Ready for EEPROM programming");
@@ -88,6 +94,12 @@ void setupAPMode() {
 
 void loop() {
   server.handleClient();
+
+  // Apply queued DSP parameter updates between requests
+  param_queue_service();
+  dsp_statusService();
+  level_stream_service();
+  sigma_tcp_service();
   
   // Optional: Add periodic status reporting
   static unsigned long lastStatus = 0;
@@ -98,6 +110,7 @@ void loop() {
   }
   
   // Small delay to prevent watchdog issues
-  // ESP32 needs a larger delay to prevent watchdog resets
-  delay(10);
+  // ESP32 needs a larger delay to prevent watchdog resets;
+  // shortened while level streaming so frames stay on schedule
+  delay(level_stream_active() ? 1 : 10);
 }
\ No newline at end of file
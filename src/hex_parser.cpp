@@ -6,43 +6,96 @@
 // Parser state variables
 static int totalBytesWritten = 0;
 static int totalLinesProcessed = 0;
-static String buffer = "";
+static int checksumErrors = 0;
 static uint32_t currentWriteAddress = 0;
 
+// Line assembly buffer (fixed size - no heap allocation while streaming).
+// Longest record: S-record / Intel HEX with 255 data bytes (~521 chars).
+const size_t LINE_BUFFER_SIZE = 544;
+static char lineBuffer[LINE_BUFFER_SIZE];
+static size_t lineLength = 0;
+static bool lineOverflow = false;
+
+// TI-TXT state: '@ADDR' opens a section, data lines follow until 'q'
+static bool tiTxtActive = false;
+static uint32_t tiTxtAddress = 0;
+
+// Image map: one bit per EEPROM byte, used to report extents and overlaps
+static uint8_t coverageMap[EEPROM_SIZE / 8];
+static UploadImageStats imageStats;
+static bool dryRun = false;
+
+// Write sink (EEPROM by default) and throughput accounting
+static HexWriteSink writeSink = writeToEEPROM;
+static ParserPerfStats perfStats;
+
 // Batch processing for efficiency
 const size_t BATCH_BUFFER_SIZE = 64;  // Match EEPROM page size
 static uint8_t batchBuffer[BATCH_BUFFER_SIZE];
 static uint16_t batchStartAddr = 0xFFFF; // Invalid start address
 static size_t batchBytes = 0;
 
-// Memory management for ESP8266
-const size_t MAX_BUFFER_SIZE = 512;
-const size_t MIN_FREE_HEAP = 4000;
-
 void hex_begin() {
   totalBytesWritten = 0;
   totalLinesProcessed = 0;
-  buffer = "";
-  buffer.reserve(256);
+  checksumErrors = 0;
+  lineLength = 0;
+  lineOverflow = false;
+  tiTxtActive = false;
+  tiTxtAddress = 0;
   currentWriteAddress = 0;
   batchStartAddr = 0xFFFF;
   batchBytes = 0;
-  
+  memset(coverageMap, 0, sizeof(coverageMap));
+  memset(&imageStats, 0, sizeof(imageStats));
+  imageStats.minAddress = 0xFFFFFFFF;
+  memset(&perfStats, 0, sizeof(perfStats));
+  perfStats.minFreeHeap = ESP.getFreeHeap();
+  perfStats.startFreeHeap = perfStats.minFreeHeap;
+
   Serial.println("✓ Hex parser initialized");
 }
 
+// Hex digit helpers (no strtol/substring temporaries)
+static inline int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static inline bool hexByteAt(const char* p, uint8_t &out) {
+  int hi = hexNibble(p[0]);
+  int lo = hexNibble(p[1]);
+  if (hi < 0 || lo < 0) return false;
+  out = (uint8_t)((hi << 4) | lo);
+  return true;
+}
+
 void flushBatch() {
   if (batchBytes > 0 && batchStartAddr != 0xFFFF) {
+    imageStats.estimatedWriteUs += estimateEEPROMWriteTimeUs(batchStartAddr, batchBytes);
+
+    if (dryRun) {
+      // Validation only - account the bytes without touching the bus
+      totalBytesWritten += batchBytes;
+      batchBytes = 0;
+      batchStartAddr = 0xFFFF;
+      return;
+    }
+
     Serial.printf("Flushing batch: 0x%04X, %d bytes\n", batchStartAddr, batchBytes);
-    
-    bool success = writeToEEPROM(batchStartAddr, batchBuffer, batchBytes);
+
+    unsigned long sinkStart = micros();
+    bool success = writeSink(batchStartAddr, batchBuffer, batchBytes);
+    perfStats.sinkUs += micros() - sinkStart;
     if (success) {
       totalBytesWritten += batchBytes;
       Serial.printf("✓ Batch write: %d bytes at 0x%04X\n", batchBytes, batchStartAddr);
     } else {
       Serial.printf("✗ Batch write failed: %d bytes at 0x%04X\n", batchBytes, batchStartAddr);
     }
-    
+
     batchBytes = 0;
     batchStartAddr = 0xFFFF;
     yield(); // Allow background tasks
@@ -52,164 +105,376 @@ void flushBatch() {
 void addToBatch(uint16_t address, const uint8_t* data, size_t length) {
   for (size_t i = 0; i < length; i++) {
     uint16_t currentAddr = address + i;
-    
+
+    // Track the image map (extents, byte count, overlapping records)
+    if (currentAddr < EEPROM_SIZE) {
+      uint8_t mask = 1 << (currentAddr & 7);
+      if (coverageMap[currentAddr >> 3] & mask) {
+        imageStats.overlapBytes++;
+      } else {
+        coverageMap[currentAddr >> 3] |= mask;
+        imageStats.uniqueBytes++;
+      }
+      if (currentAddr < imageStats.minAddress) imageStats.minAddress = currentAddr;
+      if (currentAddr > imageStats.maxAddress) imageStats.maxAddress = currentAddr;
+    }
+
     // If this address doesn't continue current batch, flush it
-    if (batchStartAddr != 0xFFFF && 
+    if (batchStartAddr != 0xFFFF &&
         (currentAddr != batchStartAddr + batchBytes || batchBytes >= BATCH_BUFFER_SIZE)) {
       flushBatch();
     }
-    
+
     // Start new batch if needed
     if (batchStartAddr == 0xFFFF) {
       batchStartAddr = currentAddr;
       batchBytes = 0;
     }
-    
+
     // Add byte to batch
     batchBuffer[batchBytes] = data[i];
     batchBytes++;
   }
 }
 
-// Replace processHexChunk with memory-optimized version:
-void processHexChunk(const char* chunk, size_t chunkLen) {
-  // More aggressive memory management for ESP8266
-  if (ESP.getFreeHeap() < 5000) { // Increased threshold
-    Serial.printf("LOW MEMORY: %d bytes free - skipping chunk\n", ESP.getFreeHeap());
-    delay(10);
-    return;
+// Reject data that would land outside the EEPROM before it reaches the batch
+static bool checkRecordRange(uint32_t address, size_t length) {
+  // Written so that S3 addresses near 0xFFFFFFFF cannot wrap past the check
+  if (length > EEPROM_SIZE || address > EEPROM_SIZE - length) {
+    Serial.printf("Record out of range: 0x%08X + %u\n", address, (unsigned)length);
+    imageStats.outOfRangeRecords++;
+    return false;
+  }
+  return true;
+}
+
+// Dispatch one complete, trimmed line to the matching format parser
+static void dispatchLine(const char* line, size_t len) {
+  if (len == 0) return;
+
+  char first = line[0];
+  if (first == ':') {
+    parseAndWriteHexLine(line, len);
+  } else if ((first == 'S' || first == 's') && len >= 2 && isdigit((unsigned char)line[1])) {
+    parseAndWriteSRecordLine(line, len);
+  } else if (first == '@' || first == 'q' || first == 'Q' || tiTxtActive) {
+    parseAndWriteTiTxtLine(line, len);
+  } else if (strstr(line, "0x") != nullptr || strstr(line, "0X") != nullptr) {
+    parseAndWriteCArrayLine(line, len);
+  }
+}
+
+// Trim the assembled line in place and hand it to the dispatcher
+static void finishLine() {
+  if (lineOverflow) {
+    Serial.printf("Line too long (>%u chars) - record dropped\n", (unsigned)(LINE_BUFFER_SIZE - 1));
+    checksumErrors++;
+  } else {
+    size_t start = 0;
+    size_t end = lineLength;
+    while (start < end && isspace((unsigned char)lineBuffer[start])) start++;
+    while (end > start && isspace((unsigned char)lineBuffer[end - 1])) end--;
+    lineBuffer[end] = '\0';
+    dispatchLine(lineBuffer + start, end - start);
   }
 
-  // Process character by character to avoid large string allocations
+  lineLength = 0;
+  lineOverflow = false;
+}
+
+// Streaming entry point: assembles lines across chunk boundaries in a
+// fixed buffer, so arbitrarily split uploads parse identically.
+void processHexChunk(const char* chunk, size_t chunkLen) {
   for (size_t i = 0; i < chunkLen; i++) {
     char c = chunk[i];
     if (c == '\r') continue; // Skip carriage returns
-    
-    if (c == '\n' || buffer.length() >= 128) { // Smaller buffer size
-      if (buffer.length() > 0) {
-        buffer.trim();
-        
-        if (buffer.length() > 0) {
-          if (buffer.startsWith(":")) {
-            parseAndWriteHexLine(buffer);
-          } else if (buffer.indexOf("0x") >= 0) {
-            // C array format - add this function
-            parseAndWriteCArrayLine(buffer);
-          }
-          // Free memory immediately
-          buffer = "";
-          buffer.reserve(128);
-        }
-      }
-      if (c == '\n') continue;
+
+    if (c == '\n') {
+      finishLine();
+      continue;
+    }
+
+    if (lineLength < LINE_BUFFER_SIZE - 1) {
+      lineBuffer[lineLength++] = c;
+    } else {
+      lineOverflow = true;
     }
-    
-    buffer += c;
   }
-  
-  // Force garbage collection if memory is critical
-  if (ESP.getFreeHeap() < 3000) {
-    Serial.println("CRITICAL MEMORY - forcing cleanup");
-    buffer = "";
-    flushBatch();
-    delay(10);
+
+  // Empty chunk marks end of stream - process a final unterminated line
+  if (chunkLen == 0 && (lineLength > 0 || lineOverflow)) {
+    finishLine();
   }
 }
 
-// Add C array parser function:
-int parseAndWriteCArrayLine(const String &line) {
-  String cleanLine = line;
-  cleanLine.replace(" ", "");
-  cleanLine.replace(",", " ");
-  cleanLine.trim();
-  
+// C array parser ("0x12, 0x34, ..."), one byte per 0x token
+int parseAndWriteCArrayLine(const char* line, size_t len) {
   int bytesWritten = 0;
-  int startIndex = 0;
-  
-  while (startIndex < (int)cleanLine.length()) {
-    int hexIndex = cleanLine.indexOf("0x", startIndex);
-    if (hexIndex == -1) break;
-    
-if (hexIndex + 4 <= (int)cleanLine.length()) {
-      String byteStr = cleanLine.substring(hexIndex + 2, hexIndex + 4);
-      uint8_t byteVal = strtol(byteStr.c_str(), NULL, 16);
+  size_t i = 0;
+
+  while (i + 2 < len) {
+    if (line[i] == '0' && (line[i + 1] == 'x' || line[i + 1] == 'X')) {
+      int hi = hexNibble(line[i + 2]);
+      if (hi < 0) {
+        i += 2;
+        continue;
+      }
+      uint8_t byteVal = (uint8_t)hi;
+      size_t next = i + 3;
+      if (next < len) {
+        int lo = hexNibble(line[next]);
+        if (lo >= 0) {
+          byteVal = (uint8_t)((hi << 4) | lo);
+          next++;
+        }
+      }
+      if (!checkRecordRange(currentWriteAddress, 1)) break;
       addToBatch(currentWriteAddress, &byteVal, 1);
       bytesWritten++;
       currentWriteAddress++;
-      startIndex = hexIndex + 4;
+      i = next;
     } else {
-      break;
-    }
-    
-    // Prevent memory issues with large lines
-    if (bytesWritten % 16 == 0) {
-      yield();
+      i++;
     }
   }
-  
+
   if (bytesWritten > 0) {
     Serial.printf("C Array: %d bytes at 0x%04X\n", bytesWritten, currentWriteAddress - bytesWritten);
   }
-  
+
   return bytesWritten;
 }
 
-int parseAndWriteHexLine(const String &hexLine) {
+int parseAndWriteHexLine(const char* line, size_t len) {
   // Basic validation
-  if (hexLine.length() < 11) {
+  if (len < 11) {
     return 0;
   }
 
   // Parse HEX record fields
-  int byteCount = strtol(hexLine.substring(1, 3).c_str(), NULL, 16);
-  uint16_t address = strtol(hexLine.substring(3, 7).c_str(), NULL, 16);
-  int recordType = strtol(hexLine.substring(7, 9).c_str(), NULL, 16);
+  uint8_t byteCount, addrHigh, addrLow, recordType;
+  if (!hexByteAt(line + 1, byteCount) || !hexByteAt(line + 3, addrHigh) ||
+      !hexByteAt(line + 5, addrLow) || !hexByteAt(line + 7, recordType)) {
+    Serial.println("HEX: malformed record");
+    checksumErrors++;
+    return 0;
+  }
+  uint16_t address = ((uint16_t)addrHigh << 8) | addrLow;
+
+  // Validate length and checksum (sum of all record bytes == 0 mod 256)
+  if (len < 11 + (size_t)byteCount * 2) {
+    Serial.printf("HEX: 0x%04X [INCOMPLETE]\n", address);
+    return 0;
+  }
+
+  uint8_t sum = byteCount + addrHigh + addrLow + recordType;
+  for (size_t i = 0; i <= byteCount; i++) {
+    uint8_t b;
+    if (!hexByteAt(line + 9 + i * 2, b)) {
+      Serial.printf("HEX: 0x%04X [BAD DIGIT]\n", address);
+      checksumErrors++;
+      return 0;
+    }
+    sum += b;
+  }
+  if (sum != 0) {
+    Serial.printf("HEX: 0x%04X [CHECKSUM ERROR]\n", address);
+    checksumErrors++;
+    return 0;
+  }
 
   Serial.printf("HEX: 0x%04X (%d), bytes=%d, type=0x%02X", address, address, byteCount, recordType);
-  
+
   // Handle different record types
   if (recordType == 0x01) { // End of File
     Serial.println(" [EOF]");
     flushBatch(); // Ensure all data is written
     return 0;
   }
-  
+
   if (recordType == 0x00 && byteCount > 0) { // Data record
-    // Validate we have enough data
-    if ((int)hexLine.length() < 11 + byteCount * 2) {
-      Serial.println(" [INCOMPLETE]");
+    if (!checkRecordRange(address, byteCount)) {
       return 0;
     }
-    
+
     Serial.println(" [DATA]");
-    
+
     // Parse and batch the data bytes
     for (int i = 0; i < byteCount; i++) {
-      String byteStr = hexLine.substring(9 + i * 2, 11 + i * 2);
-      uint8_t byteVal = strtol(byteStr.c_str(), NULL, 16);
+      uint8_t byteVal = 0;
+      hexByteAt(line + 9 + i * 2, byteVal);
       addToBatch(address + i, &byteVal, 1);
     }
-    
+
     totalLinesProcessed++;
     return byteCount;
   }
-  
+
   // Handle other record types (extended address, etc.)
-  if (recordType == 0x04) { // Extended Linear Address
-    uint16_t upperAddress = strtol(hexLine.substring(9, 13).c_str(), NULL, 16);
+  if (recordType == 0x04 && byteCount == 2) { // Extended Linear Address
+    uint8_t hi = 0, lo = 0;
+    hexByteAt(line + 9, hi);
+    hexByteAt(line + 11, lo);
+    uint16_t upperAddress = ((uint16_t)hi << 8) | lo;
     currentWriteAddress = (uint32_t)upperAddress << 16;
     Serial.printf(" [EXT_ADDR: 0x%04X]\n", upperAddress);
-  } else if (recordType == 0x02) { // Extended Segment Address
-    uint16_t segmentAddress = strtol(hexLine.substring(9, 13).c_str(), NULL, 16);
+  } else if (recordType == 0x02 && byteCount == 2) { // Extended Segment Address
+    uint8_t hi = 0, lo = 0;
+    hexByteAt(line + 9, hi);
+    hexByteAt(line + 11, lo);
+    uint16_t segmentAddress = ((uint16_t)hi << 8) | lo;
     currentWriteAddress = (uint32_t)segmentAddress << 4;
     Serial.printf(" [SEG_ADDR: 0x%04X]\n", segmentAddress);
   } else {
     Serial.printf(" [UNKNOWN: 0x%02X]\n", recordType);
   }
-  
+
   return 0;
 }
 
+// Motorola S-record: S<type><count><address><data><checksum>
+// count covers address + data + checksum; checksum is the ones' complement
+// of the low byte of the sum of count, address and data bytes.
+int parseAndWriteSRecordLine(const char* line, size_t len) {
+  if (len < 4) {
+    return 0;
+  }
+
+  char type = line[1];
+  uint8_t count;
+  if (!hexByteAt(line + 2, count) || len < 4 + (size_t)count * 2) {
+    Serial.println("SREC: [INCOMPLETE]");
+    checksumErrors++;
+    return 0;
+  }
+
+  uint8_t sum = count;
+  for (size_t i = 0; i < count; i++) {
+    uint8_t b;
+    if (!hexByteAt(line + 4 + i * 2, b)) {
+      Serial.println("SREC: [BAD DIGIT]");
+      checksumErrors++;
+      return 0;
+    }
+    sum += b;
+  }
+  if (sum != 0xFF) {
+    Serial.printf("SREC: S%c [CHECKSUM ERROR]\n", type);
+    checksumErrors++;
+    return 0;
+  }
+
+  size_t addrBytes;
+  switch (type) {
+    case '1': addrBytes = 2; break;
+    case '2': addrBytes = 3; break;
+    case '3': addrBytes = 4; break;
+    case '7': case '8': case '9': // Termination records
+      Serial.printf("SREC: S%c [END]\n", type);
+      flushBatch();
+      return 0;
+    default: // S0 header, S5/S6 record counts
+      return 0;
+  }
+
+  if (count < addrBytes + 1) {
+    return 0;
+  }
+
+  // Digits were all validated by the checksum pass above
+  uint32_t address = 0;
+  for (size_t i = 0; i < addrBytes; i++) {
+    uint8_t b = 0;
+    hexByteAt(line + 4 + i * 2, b);
+    address = (address << 8) | b;
+  }
+
+  size_t dataBytes = count - addrBytes - 1;
+  if (dataBytes == 0 || !checkRecordRange(address, dataBytes)) {
+    return 0;
+  }
+
+  const char* data = line + 4 + addrBytes * 2;
+  for (size_t i = 0; i < dataBytes; i++) {
+    uint8_t byteVal = 0;
+    hexByteAt(data + i * 2, byteVal);
+    addToBatch(address + i, &byteVal, 1);
+  }
+
+  #if EEPROM_DEBUG
+  Serial.printf("SREC: S%c 0x%04X, bytes=%u\n", type, address, (unsigned)dataBytes);
+  #endif
+
+  totalLinesProcessed++;
+  return dataBytes;
+}
+
+// TI-TXT: "@ADDR" section headers, whitespace separated data bytes, "q" ends.
+// The format carries no checksum; malformed tokens are counted as errors.
+int parseAndWriteTiTxtLine(const char* line, size_t len) {
+  if (line[0] == 'q' || line[0] == 'Q') {
+    Serial.println("TI-TXT: [END]");
+    flushBatch();
+    tiTxtActive = false;
+    return 0;
+  }
+
+  if (line[0] == '@') {
+    uint32_t address = 0;
+    size_t digits = 0;
+    for (size_t i = 1; i < len; i++) {
+      int n = hexNibble(line[i]);
+      if (n < 0) break;
+      address = (address << 4) | n;
+      digits++;
+    }
+    if (digits == 0) {
+      Serial.println("TI-TXT: malformed section address");
+      checksumErrors++;
+      tiTxtActive = false;
+      return 0;
+    }
+    tiTxtAddress = address;
+    tiTxtActive = true;
+    Serial.printf("TI-TXT: section @0x%04X\n", tiTxtAddress);
+    return 0;
+  }
+
+  int bytesWritten = 0;
+  size_t i = 0;
+  while (i < len) {
+    if (isspace((unsigned char)line[i])) {
+      i++;
+      continue;
+    }
+    uint8_t byteVal;
+    if (i + 1 >= len || !hexByteAt(line + i, byteVal) ||
+        (i + 2 < len && !isspace((unsigned char)line[i + 2]))) {
+      Serial.printf("TI-TXT: bad token at 0x%04X\n", tiTxtAddress);
+      checksumErrors++;
+      break;
+    }
+    if (!checkRecordRange(tiTxtAddress, 1)) break;
+    addToBatch(tiTxtAddress, &byteVal, 1);
+    tiTxtAddress++;
+    bytesWritten++;
+    i += 2;
+  }
+
+  if (bytesWritten > 0) {
+    totalLinesProcessed++;
+  }
+  return bytesWritten;
+}
+
+int parseAndWriteHexLine(const String &hexLine) {
+  return parseAndWriteHexLine(hexLine.c_str(), hexLine.length());
+}
+
+int parseAndWriteCArrayLine(const String &line) {
+  return parseAndWriteCArrayLine(line.c_str(), line.length());
+}
+
 // Legacy function - kept for compatibility
 int parseAndWriteRawLine(const String &rawLine) {
   return 0; // Not implemented in this version
@@ -218,18 +483,90 @@ int parseAndWriteRawLine(const String &rawLine) {
 int writeHexToEEPROM(const String &hexData) {
   hex_begin(); // Reset state
   processHexChunk(hexData.c_str(), hexData.length());
+  processHexChunk("", 0); // Final unterminated line
   flushBatch(); // Final flush
   return totalBytesWritten;
 }
 
-int getTotalBytesWritten() { 
-  return totalBytesWritten; 
+int getTotalBytesWritten() {
+  return totalBytesWritten;
+}
+
+int getTotalLinesProcessed() {
+  return totalLinesProcessed;
+}
+
+int getChecksumErrors() {
+  return checksumErrors;
 }
 
-int getTotalLinesProcessed() { 
-  return totalLinesProcessed; 
+void hex_setWriteSink(HexWriteSink sink) {
+  writeSink = sink ? sink : writeToEEPROM;
 }
 
-void resetUploadStats() { 
+void hex_accountChunk(size_t inputBytes, uint32_t elapsedUs) {
+  perfStats.inputBytes += inputBytes;
+  perfStats.chunks++;
+  perfStats.totalUs += elapsedUs;
+  uint32_t heap = ESP.getFreeHeap();
+  if (heap < perfStats.minFreeHeap) perfStats.minFreeHeap = heap;
+}
+
+void hex_accountSink(uint32_t elapsedUs) {
+  perfStats.sinkUs += elapsedUs;
+}
+
+const ParserPerfStats& hex_getPerfStats() {
+  return perfStats;
+}
+
+void hex_setDryRun(bool enabled) {
+  dryRun = enabled;
+}
+
+bool hex_isDryRun() {
+  return dryRun;
+}
+
+void noteOutOfRangeRecord() {
+  imageStats.outOfRangeRecords++;
+}
+
+const UploadImageStats& getUploadImageStats() {
+  imageStats.checksumErrors = checksumErrors;
+  return imageStats;
+}
+
+// Walk the image map and report contiguous runs of written bytes.
+// Returns the total number of segments (may exceed maxSegments).
+int getUploadSegments(UploadSegment* out, int maxSegments) {
+  int count = 0;
+  uint32_t addr = 0;
+
+  while (addr < EEPROM_SIZE) {
+    // Skip empty bytes of the map quickly
+    if ((addr & 7) == 0 && coverageMap[addr >> 3] == 0) {
+      addr += 8;
+      continue;
+    }
+    if (!(coverageMap[addr >> 3] & (1 << (addr & 7)))) {
+      addr++;
+      continue;
+    }
+
+    uint32_t start = addr;
+    while (addr < EEPROM_SIZE && (coverageMap[addr >> 3] & (1 << (addr & 7)))) {
+      addr++;
+    }
+    if (count < maxSegments) {
+      out[count].start = start;
+      out[count].length = addr - start;
+    }
+    count++;
+  }
+  return count;
+}
+
+void resetUploadStats() {
   hex_begin();
-}
\ No newline at end of file
+}
@@ -3,28 +3,87 @@
 
 #include <Arduino.h>
 
+// Image map accumulated while parsing (valid in normal and dry-run mode)
+struct UploadImageStats {
+  uint32_t minAddress;         // 0xFFFFFFFF if nothing was written
+  uint32_t maxAddress;
+  uint32_t uniqueBytes;        // Distinct EEPROM addresses written
+  uint32_t overlapBytes;       // Bytes written more than once
+  uint32_t outOfRangeRecords;  // Records rejected for exceeding EEPROM_SIZE
+  uint32_t checksumErrors;
+  uint32_t estimatedWriteUs;   // Programming time estimate for the batches
+};
+
+struct UploadSegment {
+  uint16_t start;
+  uint16_t length;
+};
+
+// Parser throughput accounting (fed by the upload handler per chunk).
+// Parse time = totalUs - sinkUs; heap figures show allocation pressure.
+struct ParserPerfStats {
+  uint32_t inputBytes;      // Raw upload bytes handed to the parsers
+  uint32_t chunks;
+  uint32_t totalUs;         // Time spent in parser calls, sink included
+  uint32_t sinkUs;          // Time spent in the write sink (I2C)
+  uint32_t startFreeHeap;
+  uint32_t minFreeHeap;     // Low-water mark sampled after each chunk
+};
+
+// Destination for flushed batches. Defaults to writeToEEPROM; a stub
+// sink lets the parser run without I2C (host builds, benchmarks).
+typedef bool (*HexWriteSink)(uint16_t address, uint8_t data[], int length);
+
 // Initialize hex parser state
 void hex_begin();
 
-// Process incoming hex data chunks
+// Process incoming text chunks (Intel HEX, S-record, TI-TXT, C arrays).
+// Pass an empty chunk at end of stream to process a final unterminated line.
 void processHexChunk(const char* chunk, size_t chunkLen);
 
 // Force flush any remaining batched data to EEPROM
 void flushBatch();
 
-// Parse and write a single hex line
+// Queue bytes for page-batched EEPROM writes (shared with sigma_import)
+void addToBatch(uint16_t address, const uint8_t* data, size_t length);
+
+// Parse and write a single Intel HEX line
+int parseAndWriteHexLine(const char* line, size_t len);
 int parseAndWriteHexLine(const String &hexLine);
 
+// Parse and write a single Motorola S-record line (S1/S2/S3 data)
+int parseAndWriteSRecordLine(const char* line, size_t len);
+
+// Parse and write a single TI-TXT line (@ADDR, data bytes or q)
+int parseAndWriteTiTxtLine(const char* line, size_t len);
+
 // Write complete hex data to EEPROM
 int writeHexToEEPROM(const String &hexData);
 
+int parseAndWriteCArrayLine(const char* line, size_t len);
 int parseAndWriteCArrayLine(const String &line);
 
 // Get statistics
 int getTotalBytesWritten();
 int getTotalLinesProcessed();
+int getChecksumErrors();
+
+// Write sink and throughput accounting
+void hex_setWriteSink(HexWriteSink sink);
+void hex_accountChunk(size_t inputBytes, uint32_t elapsedUs);
+void hex_accountSink(uint32_t elapsedUs);   // Writes made outside the sink (DSP bursts)
+const ParserPerfStats& hex_getPerfStats();
+
+// Dry-run mode: parse and build the image map without any EEPROM writes
+void hex_setDryRun(bool enabled);
+bool hex_isDryRun();
+
+// Image map access
+void noteOutOfRangeRecord();
+const UploadImageStats& getUploadImageStats();
+int getUploadSegments(UploadSegment* out, int maxSegments);
 
 // Reset parser state
 void resetUploadStats();
 
-#endif
\ No newline at end of file
+#endif
@@ -102,10 +102,10 @@ const char MAIN_PAGE[] = R"rawliteral(
             <span class="connection-status disconnected"></span> Core: Unknown
         </div>
         <div class="status" id="dspClockStatus">
-            <span class="connection-status disconnected"></span> Clock: Unknown
+            <span class="connection-status disconnected"></span> Safeload: Unknown
         </div>
         <div class="status" id="dspPLLStatus">
-            <span class="connection-status disconnected"></span> PLL: Unknown
+            <span class="connection-status disconnected"></span> Core control: Unknown
         </div>
     </div>
 
@@ -129,10 +129,12 @@ const char MAIN_PAGE[] = R"rawliteral(
             <h2>File Upload & Programming</h2>
             <p>Select HEX or BIN file:</p>
             <div class="file-input">
-                <input type="file" id="hexFile" accept=".hex,.bin,.txt,.rom">
-                <div style="margin-top:8px;font-size:11px;color:#666">Supports: HEX, Binary, C Arrays</div>
+                <input type="file" id="hexFile" accept=".hex,.bin,.txt,.rom,.s19,.s28,.s37,.srec,.mot,.dat" multiple>
+                <div style="margin-top:8px;font-size:11px;color:#666">Supports: Intel HEX, S-record, TI-TXT, Binary, C Arrays, SigmaStudio E2Prom.Hex / TxBuffer+NumBytes</div>
             </div>
             <button class="btn" id="uploadBtn" onclick="uploadHexStream()" disabled>Upload & Program</button>
+            <button class="btn" id="dryRunBtn" onclick="uploadHexStream(true)" disabled>Validate Only</button>
+            <button class="btn btn-warning" id="dspLoadBtn" onclick="uploadHexStream(false,true)" disabled>Load to DSP RAM</button>
             <div class="progress-container"><div id="uploadProgress" class="progress-bar">0%</div></div>
             <div id="uploadStatus" class="status info">Select file to begin</div>
         </div>
@@ -230,8 +232,11 @@ async function dspSelfBoot() {
         const res = await fetch('/dsp/self_boot', {method: 'POST'});
         const data = await res.json();
         if (data.success) {
-            log('Self-boot initiated', 'success');
-            setTimeout(readDSPStatus, 1000); // Allow time for boot
+            log('Self-boot completed in ' + (data.boot.total_us / 1000).toFixed(1) + ' ms' +
+                (data.boot.regression ? ' (slower than baseline)' : ''), 'success');
+            readDSPStatus();
+        } else {
+            log('Self-boot failed: ' + data.message, 'error');
         }
     } catch(e) { 
         log('Self-boot error: ' + e.message, 'error'); 
@@ -273,15 +278,15 @@ async function readDSPStatus() {
             coreElem.innerHTML = `<span class="connection-status ${data.core_running ? 'connected' : 'disconnected'}"></span> Core: ${data.core_running ? 'Running' : 'Stopped'}`;
             coreElem.className = `status ${data.core_running ? 'success' : 'warning'}`;
             
-            // Update clock status
+            // Update safeload status
             const clockElem = document.getElementById('dspClockStatus');
-            clockElem.innerHTML = `<span class="connection-status ${data.dck_stable ? 'connected' : 'disconnected'}"></span> Clock: ${data.dck_stable ? 'Stable' : 'Unstable'}`;
-            clockElem.className = `status ${data.dck_stable ? 'success' : 'error'}`;
+            clockElem.innerHTML = `<span class="connection-status ${data.safeload_pending ? 'disconnected' : 'connected'}"></span> Safeload: ${data.safeload_pending ? 'Pending' : 'Idle'}`;
+            clockElem.className = `status ${data.safeload_pending ? 'warning' : 'success'}`;
             
-            // Update PLL status
+            // Raw core control register
             const pllElem = document.getElementById('dspPLLStatus');
-            pllElem.innerHTML = `<span class="connection-status ${data.pll_locked ? 'connected' : 'disconnected'}"></span> PLL: ${data.pll_locked ? 'Locked' : 'Unlocked'}`;
-            pllElem.className = `status ${data.pll_locked ? 'success' : 'warning'}`;
+            pllElem.innerHTML = `<span class="connection-status connected"></span> Core control: 0x${data.core_control.toString(16).padStart(4, '0')}`;
+            pllElem.className = 'status success';
             
         } else {
             log('DSP status read failed', 'error');
@@ -294,25 +299,20 @@ async function readDSPStatus() {
 async function runDSPDiagnostic() {
     log('Running comprehensive DSP diagnostic...', 'info');
     try {
-        const res = await fetch('/dsp/diagnostic');
+        const res = await fetch('/dsp/diagnostic?write_test=1');
         const data = await res.json();
         
         log(`=== DSP DIAGNOSTIC RESULTS ===`, 'info');
         log(`Basic I2C Detection: ${data.basic_detection ? '✅ SUCCESS' : '❌ FAILED'} (result code: ${data.detect_result})`, 
             data.basic_detection ? 'success' : 'error');
         
-        if (data.hardware_id !== undefined) {
-            log(`Hardware ID: 0x${data.hardware_id.toString(16).padStart(2, '0')} ${data.hardware_valid ? '✅ (VALID ADAU1701)' : '❌ (INVALID - expected 0x02)'}`, 
-                data.hardware_valid ? 'success' : 'error');
-        }
-        
         if (data.write_test !== undefined) {
             log(`Register Write Test: ${data.write_test ? '✅ SUCCESS' : '❌ FAILED'} (result: ${data.write_result})`, 
                 data.write_test ? 'success' : 'error');
         }
         
-        if (data.control_readback !== undefined) {
-            log(`Control Register Readback: 0x${data.control_readback.toString(16).padStart(2, '0')}`, 'info');
+        if (data.core_control !== undefined) {
+            log(`Core Control: 0x${data.core_control.toString(16).padStart(4, '0')} (core ${data.core_running ? 'running' : 'held'})`, 'info');
         }
         
         log(`Free Heap: ${data.free_heap_start} → ${data.free_heap_end} bytes`, 'info');
@@ -323,8 +323,8 @@ async function runDSPDiagnostic() {
             log('❌ DSP communication issues detected', 'error');
             
             // Provide troubleshooting tips based on results
-            if (data.basic_detection && !data.hardware_valid) {
-                log('💡 TROUBLESHOOTING: DSP responds but returns wrong hardware ID. Check:', 'warning');
+            if (data.basic_detection) {
+                log('💡 TROUBLESHOOTING: DSP responds but the write test failed. Check:', 'warning');
                 log('   - I2C address configuration (should be 0x34 for 7-bit)', 'warning');
                 log('   - DSP power supply (3.3V stable)', 'warning');
                 log('   - DSP reset line (should be HIGH for operation)', 'warning');
@@ -403,11 +403,11 @@ async function detectEEPROM(){
 }
 
 async function eraseEEPROM(){
-    if(!confirm('⚠️ ERASE ENTIRE EEPROM?\n\nThis cannot be undone!'))return;
+    if(!confirm('⚠️ ERASE EEPROM?\n\nOnly the stored self-boot image region is erased (whole chip if no valid image).\nThis cannot be undone!'))return;
     log('Erasing EEPROM...','warning');
     try{
         const r=await fetch('/erase',{method:'POST'}),d=await r.json();
-        if(d.success)log('EEPROM erased','success');else log('Erase fail: '+d.message,'error');
+        if(d.success)log(`${d.message} (${d.erasedBytes} bytes)`,'success');else log('Erase fail: '+d.message,'error');
     }catch(e){log('Erase err: '+e.message,'error');}
 }
 
@@ -417,7 +417,7 @@ function formatFileSize(b){
     else return(b/1048576).toFixed(1)+'MB';
 }
 
-async function uploadHexStream(){
+async function uploadHexStream(dry=false,toDsp=false){
     const f=document.getElementById('hexFile').files[0];
     if(!f){log('No file','error');return;}
     if(uploadInProgress){log('Upload in progress','warning');return;}
@@ -425,11 +425,14 @@ async function uploadHexStream(){
     const b=document.getElementById('uploadBtn'),p=document.getElementById('uploadProgress'),s=document.getElementById('uploadStatus');
     try{
         b.disabled=true;b.innerHTML='Uploading...';s.innerHTML='<div class="info">Starting upload...</div>';p.style.width='0%';p.textContent='0%';
-        log(`Upload: ${f.name} (${formatFileSize(f.size)})`);startProgressPolling();
-        const fd=new FormData();fd.append('file',f);
-        const r=await fetch(`/upload_stream?size=${f.size}`,{method:'POST',body:fd});
+        // SigmaStudio TxBuffer needs its NumBytes table first - send NumBytes files ahead
+        const fs=Array.from(document.getElementById('hexFile').files).sort((x,y)=>(/numbytes/i.test(y.name)?1:0)-(/numbytes/i.test(x.name)?1:0));
+        const total=fs.reduce((a,x)=>a+x.size,0);
+        log(`Upload: ${fs.map(x=>x.name).join(' + ')} (${formatFileSize(total)})`);startProgressPolling();
+        const fd=new FormData();fs.forEach((x,i)=>fd.append('file'+i,x));
+        const r=await fetch(`/upload_stream?size=${total}${dry?'&dryrun=1':''}${toDsp?'&target=dsp':''}`,{method:'POST',body:fd});
         clearInterval(progressInterval);uploadInProgress=false;b.disabled=false;b.innerHTML='Upload & Program';
-        if(r.ok){const d=await r.json();handleUploadResponse(d);}else throw new Error(`HTTP ${r.status}`);
+        if(r.ok){const d=await r.json();if(d.dryRun)handleDryRunResponse(d);else if(d.target==='dsp')handleDspLoadResponse(d);else handleUploadResponse(d);}else throw new Error(`HTTP ${r.status}`);
     }catch(e){
         clearInterval(progressInterval);uploadInProgress=false;b.disabled=false;b.innerHTML='Upload & Program';
         s.innerHTML=`<div class="error">Upload err: ${e.message}</div>`;log(`Upload err: ${e.message}`,'error');
@@ -450,12 +453,26 @@ function handleUploadResponse(d){
     const s=document.getElementById('uploadStatus'),p=document.getElementById('uploadProgress');
     if(d.success){
         p.style.width='100%';p.textContent='100%';s.innerHTML='<div class="success">Programming done!</div>';
-        log(`Programming: ${d.bytesWritten} bytes`,'success');
+        log(`Programming: ${d.bytesWritten} bytes`+(d.sigmaExport?` from ${d.sigmaExport} (${d.transactions} transactions)`:''),'success');
     }else{
         s.innerHTML=`<div class="error">Programming fail: ${d.message}</div>`;log(`Programming fail: ${d.message}`,'error');
     }
 }
 
+function handleDspLoadResponse(d){
+    const s=document.getElementById('uploadStatus');
+    s.innerHTML=`<div class="${d.success?'success':'error'}">${d.message}</div>`;
+    log(d.success?`DSP RAM loaded: ${d.dspBytes} bytes, ${d.transactions} transactions in ${d.downloadMs} ms`:`DSP load fail: ${d.message}`,d.success?'success':'error');
+}
+
+function handleDryRunResponse(d){
+    const s=document.getElementById('uploadStatus'),h=a=>'0x'+a.toString(16).padStart(4,'0');
+    s.innerHTML=`<div class="${d.success?'success':'error'}">${d.message}</div>`;
+    log(`Dry run: ${d.bytes} bytes${d.bytes?` ${h(d.minAddress)}-${h(d.maxAddress)}`:''}, ${d.checksumErrors} checksum err, ${d.outOfRangeRecords} out of range, ${d.overlapBytes} overlap, ~${d.estimatedProgramMs} ms`,d.success?'success':'error');
+    (d.segments||[]).forEach(g=>log(`  ${h(g.start)}-${h(g.start+g.length-1)} (${g.length} B)`,'info'));
+    if(d.segmentCount>(d.segments||[]).length)log(`  ... ${d.segmentCount-d.segments.length} more segments`,'info');
+}
+
 async function toggleWP(e){
     try{
         const r=await fetch('/wp',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify({enable:e})});
@@ -510,10 +527,11 @@ function initializeFileInput(){
             f.addEventListener('change',function(e){
                 const file=e.target.files[0],b=document.getElementById('uploadBtn'),s=document.getElementById('uploadStatus');
                 if(file){
-                    const n=file.name.toLowerCase(),ex=['.hex','.txt','.bin','.rom'],v=ex.some(ext=>n.endsWith(ext));
-                    if(!v){s.innerHTML='<div class="error">Invalid file type</div>';this.value='';b.disabled=true;return;}
-                    b.disabled=false;s.innerHTML=`<div class="success">Ready: ${file.name} (${formatFileSize(file.size)})</div>`;log(`File: ${file.name} (${formatFileSize(file.size)})`);
-                }else{b.disabled=true;s.innerHTML='<div class="info">Select file</div>';}
+                    const n=file.name.toLowerCase(),ex=['.hex','.txt','.bin','.rom','.s19','.s28','.s37','.srec','.mot','.dat'],v=ex.some(ext=>n.endsWith(ext));
+                    const dr=document.getElementById('dryRunBtn');
+                    if(!v){s.innerHTML='<div class="error">Invalid file type</div>';this.value='';b.disabled=true;dr.disabled=true;document.getElementById('dspLoadBtn').disabled=true;return;}
+                    b.disabled=false;dr.disabled=false;document.getElementById('dspLoadBtn').disabled=false;s.innerHTML=`<div class="success">Ready: ${file.name} (${formatFileSize(file.size)})</div>`;log(`File: ${file.name} (${formatFileSize(file.size)})`);
+                }else{b.disabled=true;document.getElementById('dryRunBtn').disabled=true;document.getElementById('dspLoadBtn').disabled=true;s.innerHTML='<div class="info">Select file</div>';}
             });
         }
     }catch(e){console.error('File init err:',e);}
@@ -556,7 +574,10 @@ async function verifyAgainstFile() {
     
     try {
         const fileBuffer = await readFileAsArrayBuffer(file);
-        const totalBytes = fileBuffer.byteLength;
+        // Self-boot images: verify only the used region plus blank-check margin
+        const usedBytes = selfBootUsedLength(new Uint8Array(fileBuffer));
+        const totalBytes = usedBytes || fileBuffer.byteLength;
+        if (usedBytes) log(`Self-boot image: verifying ${usedBytes} of ${fileBuffer.byteLength} bytes`, 'info');
         
         // Safety check
         if (totalBytes > 32768) {
@@ -567,7 +588,7 @@ async function verifyAgainstFile() {
         
         let verifiedBytes = 0;
         let errorCount = 0;
-        const CHUNK_SIZE = 64; // Smaller chunks for better stability
+        const CHUNK_SIZE = 256; // Device reads each chunk with sequential block reads
         
         // First, let's verify just the first few bytes to debug
         log('Debug: Checking first 16 bytes...', 'info');
@@ -666,8 +687,8 @@ async function verifyAgainstFile() {
                 errorCount++;
             }
             
-            // Increased delay for stability
-            await new Promise(resolve => setTimeout(resolve, 150));
+            // Short pause between requests
+            await new Promise(resolve => setTimeout(resolve, 20));
         }
         
         if (errorCount === 0) {
@@ -683,6 +704,21 @@ async function verifyAgainstFile() {
         uploadInProgress = false;
     }
 }
+// Walk ADAU1701 self-boot messages; returns image length + 64-byte
+// blank-check margin, or 0 if the buffer is not a complete self-boot image
+function selfBootUsedLength(b) {
+    let i = 0;
+    while (i < b.length) {
+        const t = b[i];
+        if (t === 0x00) return Math.min(b.length, i + 1 + 64);
+        if (t === 0x01) { if (i + 2 >= b.length) return 0; i += 3 + ((b[i + 1] << 8) | b[i + 2]); }
+        else if (t === 0x02) i += 3;
+        else if (t === 0x03) i += 1;
+        else return 0;
+    }
+    return 0;
+}
+
 async function readEEPROMRange(start, length) {
     try {
         const response = await fetch(`/read_range?start=${start}&length=${length}`);
@@ -719,8 +755,8 @@ async function updateDSPStatus() {
       statusElem.innerHTML = `
         <div class="status success">
           DSP: ${data.core_running ? 'RUNNING' : 'STOPPED'} | 
-          Clock: ${data.dck_stable ? 'STABLE' : 'UNSTABLE'} |
-          PLL: ${data.pll_locked ? 'LOCKED' : 'UNLOCKED'}
+          Safeload: ${data.safeload_pending ? 'PENDING' : 'IDLE'} |
+          Core control: 0x${data.core_control.toString(16).padStart(4, '0')}
         </div>
       `;
     } else {
@@ -0,0 +1,256 @@
+#include "i2c_bus.h"
+#include "config.h"
+#include "eeprom_emulator.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#define I2C_JOB_QUEUE_LEN 4
+
+struct I2CJob {
+  I2CJobFn fn;
+  void* arg;
+};
+
+struct I2CBus {
+  TwoWire* wire;
+  I2CBusInfo info;
+  SemaphoreHandle_t lock;   // Recursive - sequences nest their transactions
+  QueueHandle_t jobs;
+  TaskHandle_t worker;
+  volatile uint8_t pending; // Jobs queued or running
+};
+
+static I2CBus buses[I2C_BUS_COUNT] = {
+  { &Wire,  {}, nullptr, nullptr, nullptr, 0 },
+  { &Wire1, {}, nullptr, nullptr, nullptr, 0 },
+};
+static uint8_t deviceBus[I2C_DEVICE_COUNT] = { DSP_I2C_BUS, EEPROM_I2C_BUS };
+static const char* const kDeviceNames[I2C_DEVICE_COUNT] = { "dsp", "eeprom" };
+static portMUX_TYPE pendingMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void busWorker(void* param) {
+  I2CBus& b = buses[(uintptr_t)param];
+  I2CJob job;
+  for (;;) {
+    if (xQueueReceive(b.jobs, &job, portMAX_DELAY) == pdTRUE) {
+      job.fn(job.arg);
+      portENTER_CRITICAL(&pendingMux);
+      b.pending--;
+      b.info.jobs++;
+      portEXIT_CRITICAL(&pendingMux);
+    }
+  }
+}
+
+bool i2c_init() {
+  bool ok = i2c_busBegin(0, SDA_PIN, SCL_PIN, I2C_CLOCK_HZ);
+  if (I2C1_SDA_PIN >= 0 && I2C1_SCL_PIN >= 0) {
+    ok &= i2c_busBegin(1, I2C1_SDA_PIN, I2C1_SCL_PIN, I2C1_CLOCK_HZ);
+  }
+  for (uint8_t d = 0; d < I2C_DEVICE_COUNT; d++) {
+    if (!buses[deviceBus[d]].info.active) {
+      deviceBus[d] = 0;
+    }
+  }
+  return ok;
+}
+
+bool i2c_busBegin(uint8_t bus, int8_t sda, int8_t scl, uint32_t clockHz) {
+  if (bus >= I2C_BUS_COUNT || sda < 0 || scl < 0) {
+    return false;
+  }
+  if (bus == 1 && eeprom_emu_getStats().active) {
+    Serial.println("I2C: Wire1 is in use by the EEPROM emulator");
+    return false;
+  }
+
+  I2CBus& b = buses[bus];
+  if (!b.lock) {
+    b.lock = xSemaphoreCreateRecursiveMutex();
+    b.jobs = xQueueCreate(I2C_JOB_QUEUE_LEN, sizeof(I2CJob));
+    char name[12];
+    snprintf(name, sizeof(name), "i2c_bus%u", bus);
+    xTaskCreate(busWorker, name, I2C_WORKER_STACK, (void*)(uintptr_t)bus, 1, &b.worker);
+  }
+
+  i2c_lock(bus);
+  if (b.info.active) {
+    b.wire->end();
+  }
+  b.info.active = b.wire->begin(sda, scl, clockHz);
+  b.info.sda = sda;
+  b.info.scl = scl;
+  b.info.baseClockHz = clockHz;
+  b.info.clockHz = clockHz;
+  i2c_unlock(bus);
+
+  Serial.printf("I2C bus %u: SDA %d / SCL %d at %lu Hz %s\n", bus, sda, scl,
+                (unsigned long)clockHz, b.info.active ? "ready" : "failed");
+  return b.info.active;
+}
+
+// Rerouting must not land in the middle of a sequence that resolved the
+// old bus, so it only happens while both buses' locks are free
+static bool tryLockPair(uint8_t a, uint8_t b) {
+  I2CBus& first = buses[a];
+  I2CBus& second = buses[b];
+  if (!first.lock || xSemaphoreTakeRecursive(first.lock, 0) != pdTRUE) {
+    return false;
+  }
+  if (!second.lock || xSemaphoreTakeRecursive(second.lock, 0) != pdTRUE) {
+    xSemaphoreGiveRecursive(first.lock);
+    return false;
+  }
+  return true;
+}
+
+static void unlockPair(uint8_t a, uint8_t b) {
+  xSemaphoreGiveRecursive(buses[b].lock);
+  xSemaphoreGiveRecursive(buses[a].lock);
+}
+
+bool i2c_busEnd(uint8_t bus) {
+  if (bus == 0 || bus >= I2C_BUS_COUNT || !buses[bus].info.active) {
+    return false;
+  }
+  if (!tryLockPair(bus, 0)) {
+    return false;
+  }
+  for (uint8_t d = 0; d < I2C_DEVICE_COUNT; d++) {
+    if (deviceBus[d] == bus) {
+      deviceBus[d] = 0;
+    }
+  }
+  buses[bus].wire->end();
+  buses[bus].info.active = false;
+  unlockPair(bus, 0);
+  return true;
+}
+
+bool i2c_busActive(uint8_t bus) {
+  return bus < I2C_BUS_COUNT && buses[bus].info.active;
+}
+
+I2CBusInfo i2c_getBusInfo(uint8_t bus) {
+  if (bus >= I2C_BUS_COUNT) {
+    return I2CBusInfo{};
+  }
+  I2CBusInfo info = buses[bus].info;
+  info.jobRunning = buses[bus].pending > 0;
+  return info;
+}
+
+TwoWire& i2c_wire(uint8_t bus) {
+  return *buses[bus < I2C_BUS_COUNT ? bus : 0].wire;
+}
+
+bool i2c_setDeviceBus(I2CDevice device, uint8_t bus) {
+  if (device >= I2C_DEVICE_COUNT || !i2c_busActive(bus)) {
+    return false;
+  }
+  uint8_t from = deviceBus[device];
+  if (!tryLockPair(from, bus)) {
+    return false;
+  }
+  deviceBus[device] = bus;
+  unlockPair(from, bus);
+  return true;
+}
+
+uint8_t i2c_deviceBus(I2CDevice device) {
+  return device < I2C_DEVICE_COUNT ? deviceBus[device] : 0;
+}
+
+const char* i2c_deviceName(I2CDevice device) {
+  return device < I2C_DEVICE_COUNT ? kDeviceNames[device] : "unknown";
+}
+
+void i2c_setClock(uint8_t bus, uint32_t clockHz) {
+  if (bus >= I2C_BUS_COUNT) {
+    return;
+  }
+  I2CBus& b = buses[bus];
+  uint32_t hz = clockHz ? clockHz : b.info.baseClockHz;
+  if (hz != b.info.clockHz) {
+    b.wire->setClock(hz);
+    b.info.clockHz = hz;
+  }
+}
+
+// Waits are timed so the routes can show whether one device class is
+// holding up another on a shared bus
+void i2c_lock(uint8_t bus) {
+  I2CBus& b = buses[bus < I2C_BUS_COUNT ? bus : 0];
+  if (!b.lock) {
+    return;
+  }
+  if (xSemaphoreTakeRecursive(b.lock, 0) == pdTRUE) {
+    return;
+  }
+  unsigned long start = micros();
+  xSemaphoreTakeRecursive(b.lock, portMAX_DELAY);
+  uint32_t waited = micros() - start;
+  b.info.lockWaits++;
+  b.info.maxLockWaitUs = max(b.info.maxLockWaitUs, waited);
+}
+
+void i2c_unlock(uint8_t bus) {
+  I2CBus& b = buses[bus < I2C_BUS_COUNT ? bus : 0];
+  if (b.lock) {
+    xSemaphoreGiveRecursive(b.lock);
+  }
+}
+
+uint8_t i2c_lockDevice(I2CDevice device) {
+  for (;;) {
+    uint8_t bus = i2c_deviceBus(device);
+    i2c_lock(bus);
+    if (bus == i2c_deviceBus(device)) {
+      return bus;
+    }
+    i2c_unlock(bus);          // Rerouted while we waited
+  }
+}
+
+bool i2c_tryLockDevice(I2CDevice device, uint32_t waitMs, uint8_t& bus) {
+  for (;;) {
+    bus = i2c_deviceBus(device);
+    I2CBus& b = buses[bus];
+    if (!b.lock) {
+      return true;            // Not started yet - i2c_lock() would not block either
+    }
+    if (xSemaphoreTakeRecursive(b.lock, pdMS_TO_TICKS(waitMs)) != pdTRUE) {
+      b.info.lockWaits++;
+      return false;
+    }
+    if (bus == i2c_deviceBus(device)) {
+      return true;
+    }
+    xSemaphoreGiveRecursive(b.lock);
+  }
+}
+
+bool i2c_submit(uint8_t bus, I2CJobFn fn, void* arg) {
+  if (!i2c_busActive(bus) || !buses[bus].jobs) {
+    return false;
+  }
+  I2CBus& b = buses[bus];
+  portENTER_CRITICAL(&pendingMux);
+  b.pending++;
+  portEXIT_CRITICAL(&pendingMux);
+
+  I2CJob job = { fn, arg };
+  if (xQueueSend(b.jobs, &job, 0) != pdTRUE) {
+    portENTER_CRITICAL(&pendingMux);
+    b.pending--;
+    portEXIT_CRITICAL(&pendingMux);
+    return false;
+  }
+  return true;
+}
+
+bool i2c_busIdle(uint8_t bus) {
+  return bus >= I2C_BUS_COUNT || buses[bus].pending == 0;
+}
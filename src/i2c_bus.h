@@ -0,0 +1,71 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+// The ESP32-S2's two I2C controllers as independent buses. Bus 0 (Wire) is
+// always up on SDA_PIN/SCL_PIN; bus 1 (Wire1) is optional and shares its
+// controller with the EEPROM emulator, so only one of them can own it.
+//
+// Each device class is routed to a bus. Every bus has its own clock, a
+// recursive lock held per transaction (or per multi-transaction
+// sequence), and a worker task that runs long jobs such as gang
+// programming. With the EEPROM on bus 1, DSP traffic on bus 0 never
+// waits behind a write cycle.
+
+#define I2C_BUS_COUNT 2
+
+enum I2CDevice {
+  I2C_DEVICE_DSP,
+  I2C_DEVICE_EEPROM,
+  I2C_DEVICE_COUNT
+};
+
+struct I2CBusInfo {
+  bool active;
+  int8_t sda;
+  int8_t scl;
+  uint32_t baseClockHz;     // Clock restored after fast transfers
+  uint32_t clockHz;         // Current clock
+  uint32_t jobs;            // Worker jobs completed
+  bool jobRunning;          // Worker job queued or running
+  uint32_t lockWaits;       // Lock acquisitions that had to wait
+  uint32_t maxLockWaitUs;   // Longest wait for the lock
+};
+
+typedef void (*I2CJobFn)(void* arg);
+
+// Bus 0 from SDA_PIN/SCL_PIN, bus 1 from I2C1_SDA_PIN/I2C1_SCL_PIN if wired
+bool i2c_init();
+bool i2c_busBegin(uint8_t bus, int8_t sda, int8_t scl, uint32_t clockHz);
+bool i2c_busEnd(uint8_t bus);                 // Bus 1 only; its devices move to bus 0
+bool i2c_busActive(uint8_t bus);
+I2CBusInfo i2c_getBusInfo(uint8_t bus);
+TwoWire& i2c_wire(uint8_t bus);
+
+// Device routing. Both this and i2c_busEnd refuse while either bus's lock
+// is held, so a sequence that resolved its bus keeps it until it unlocks.
+bool i2c_setDeviceBus(I2CDevice device, uint8_t bus);
+uint8_t i2c_deviceBus(I2CDevice device);
+const char* i2c_deviceName(I2CDevice device);
+
+void i2c_setClock(uint8_t bus, uint32_t clockHz);   // 0 = base clock
+void i2c_lock(uint8_t bus);
+void i2c_unlock(uint8_t bus);
+
+// Lock the bus a device is routed to and return it; the routing cannot
+// change until i2c_unlock(bus), so a sequence resolves its bus only once
+uint8_t i2c_lockDevice(I2CDevice device);
+// Bounded variant for callers that must not stall, such as timer
+// callbacks: false if the bus stayed busy for waitMs
+bool i2c_tryLockDevice(I2CDevice device, uint32_t waitMs, uint8_t& bus);
+
+// Run fn(arg) on the bus worker task; jobs on one bus run in order
+bool i2c_submit(uint8_t bus, I2CJobFn fn, void* arg);
+bool i2c_busIdle(uint8_t bus);
+
+#define DSP_BUS     i2c_deviceBus(I2C_DEVICE_DSP)
+#define EEPROM_BUS  i2c_deviceBus(I2C_DEVICE_EEPROM)
+
+#endif // I2C_BUS_H
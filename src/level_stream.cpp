@@ -0,0 +1,180 @@
+#include "level_stream.h"
+#include "dsp_helper.h"
+
+static uint16_t streamCaptures[LEVEL_STREAM_MAX_WORDS];
+static uint16_t streamWords = 0;
+static bool capturesArmed = false;        // Both registers hold the configured selects
+static uint32_t streamPeriodUs = 1000000 / LEVEL_STREAM_DEFAULT_HZ;
+static uint16_t streamRateHz = LEVEL_STREAM_DEFAULT_HZ;
+
+static WiFiClient streamClients[LEVEL_STREAM_MAX_CLIENTS];
+static uint8_t streamClientCount = 0;
+
+static uint16_t frameSeq = 0;
+static uint32_t nextSampleUs = 0;
+static uint32_t lastSampleUs = 0;
+static uint32_t streamStartUs = 0;
+static LevelStreamStats streamStats;
+static uint64_t jitterSumUs = 0;
+
+bool level_stream_configure(const uint16_t* captures, size_t count, uint16_t rateHz) {
+  if (count == 0 || count > LEVEL_STREAM_MAX_WORDS || rateHz == 0 || rateHz > LEVEL_STREAM_MAX_HZ) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (captures[i] > ADAU1701_CAPTURE_SELECT_MAX) {
+      return false;
+    }
+  }
+
+  memcpy(streamCaptures, captures, count * sizeof(captures[0]));
+  streamWords = count;
+  capturesArmed = false;
+  streamRateHz = rateHz;
+  streamPeriodUs = 1000000UL / rateHz;
+
+  // Restart rate/jitter accounting for the new configuration
+  memset(&streamStats, 0, sizeof(streamStats));
+  jitterSumUs = 0;
+  streamStartUs = 0;
+  return true;
+}
+
+// Sample up to two points: arm the capture registers with their selects
+// (skipped when already armed), let one sample pass, then read each 5.19
+// value back and widen it to a 5.23 word
+static bool capturePair(const uint16_t* captures, size_t n, bool arm, uint8_t* out) {
+  if (arm) {
+    uint8_t select[ADAU1701_DATA_CAPTURE_REGS * 2];
+    for (size_t i = 0; i < n; i++) {
+      select[i * 2] = (uint8_t)(captures[i] >> 8);
+      select[i * 2 + 1] = (uint8_t)captures[i];
+    }
+    if (!dsp_writeBlock(ADAU1701_DATA_CAPTURE_REG, select, n * 2)) {
+      return false;
+    }
+    delayMicroseconds(LEVEL_CAPTURE_SETTLE_US);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    uint8_t raw[ADAU1701_CAPTURE_DATA_BYTES];
+    if (!dsp_readBlock(ADAU1701_DATA_CAPTURE_REG + i, raw, sizeof(raw))) {
+      return false;
+    }
+    int32_t value = (int32_t)(((uint32_t)raw[0] << 24) | ((uint32_t)raw[1] << 16) | ((uint32_t)raw[2] << 8)) >> 8;
+    uint32_t word = (uint32_t)value << 4;
+    out[i * 4 + 0] = (uint8_t)(word >> 24);
+    out[i * 4 + 1] = (uint8_t)(word >> 16);
+    out[i * 4 + 2] = (uint8_t)(word >> 8);
+    out[i * 4 + 3] = (uint8_t)word;
+  }
+  return true;
+}
+
+bool level_stream_addClient(WiFiClient client) {
+  if (streamClientCount >= LEVEL_STREAM_MAX_CLIENTS) {
+    return false;
+  }
+
+  client.setNoDelay(true);
+  client.setTimeout(1);
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: application/octet-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Access-Control-Allow-Origin: *\r\n"
+               "Connection: close\r\n\r\n");
+  streamClients[streamClientCount++] = client;
+  return true;
+}
+
+bool level_stream_active() {
+  return streamClientCount > 0 && streamWords > 0;
+}
+
+static void dropClient(uint8_t index) {
+  streamClients[index].stop();
+  streamClients[index] = streamClients[--streamClientCount];
+  streamClients[streamClientCount] = WiFiClient();
+  streamStats.droppedClients++;
+}
+
+void level_stream_service() {
+  if (!level_stream_active()) {
+    streamStartUs = 0;
+    return;
+  }
+
+  uint32_t now = micros();
+  if (streamStartUs == 0) {
+    // First client after an idle period - restart rate/jitter accounting
+    streamStartUs = now;
+    nextSampleUs = now;
+    streamStats.frames = 0;
+    streamStats.maxJitterUs = 0;
+    jitterSumUs = 0;
+  }
+  if ((int32_t)(now - nextSampleUs) < 0) {
+    return;
+  }
+
+  // Keep a fixed schedule; if we fell a whole period behind, resync
+  nextSampleUs += streamPeriodUs;
+  if ((int32_t)(now - nextSampleUs) > 0) {
+    nextSampleUs = now + streamPeriodUs;
+  }
+
+  uint8_t frame[8 + LEVEL_STREAM_MAX_WORDS * ADAU1701_PARAM_WORD_BYTES];
+  bool multiplexed = streamWords > ADAU1701_DATA_CAPTURE_REGS;
+  bool ok = true;
+  uint8_t bus = dsp_busLock();
+  for (uint16_t i = 0; i < streamWords && ok; i += ADAU1701_DATA_CAPTURE_REGS) {
+    size_t n = min((size_t)ADAU1701_DATA_CAPTURE_REGS, (size_t)(streamWords - i));
+    ok = capturePair(streamCaptures + i, n, multiplexed || !capturesArmed,
+                     frame + 8 + i * ADAU1701_PARAM_WORD_BYTES);
+  }
+  dsp_busUnlock(bus);
+  capturesArmed = ok && !multiplexed;
+  streamStats.lastReadUs = micros() - now;
+  if (!ok) {
+    streamStats.readFailures++;
+    return;
+  }
+
+  if (streamStats.frames > 0) {
+    uint32_t interval = now - lastSampleUs;
+    uint32_t jitter = interval > streamPeriodUs ? interval - streamPeriodUs : streamPeriodUs - interval;
+    jitterSumUs += jitter;
+    streamStats.maxJitterUs = max(streamStats.maxJitterUs, jitter);
+  }
+  lastSampleUs = now;
+
+  frame[0] = LEVEL_STREAM_FRAME_MAGIC;
+  frame[1] = (uint8_t)streamWords;
+  frame[2] = (uint8_t)(frameSeq >> 8);
+  frame[3] = (uint8_t)frameSeq;
+  frame[4] = (uint8_t)(now >> 24);
+  frame[5] = (uint8_t)(now >> 16);
+  frame[6] = (uint8_t)(now >> 8);
+  frame[7] = (uint8_t)now;
+  frameSeq++;
+  streamStats.frames++;
+
+  size_t frameLen = 8 + streamWords * ADAU1701_PARAM_WORD_BYTES;
+  for (int i = streamClientCount - 1; i >= 0; i--) {
+    if (!streamClients[i].connected() || streamClients[i].write(frame, frameLen) != frameLen) {
+      dropClient(i);
+    }
+  }
+}
+
+LevelStreamStats level_stream_getStats() {
+  LevelStreamStats stats = streamStats;
+  stats.words = streamWords;
+  stats.rateHz = streamRateHz;
+  stats.clients = streamClientCount;
+
+  uint32_t elapsed = streamStartUs ? micros() - streamStartUs : 0;
+  stats.sustainedHz = elapsed ? stats.frames * 1000000.0f / elapsed : 0.0f;
+  stats.avgJitterUs = stats.frames > 1 ? (uint32_t)(jitterSumUs / (stats.frames - 1)) : 0;
+  return stats;
+}
@@ -0,0 +1,50 @@
+#ifndef LEVEL_STREAM_H
+#define LEVEL_STREAM_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// Live readback streaming: a configured set of readback points is sampled
+// through the DSP's data capture registers at a fixed rate and pushed as
+// binary frames to every client holding GET /dsp/levels/stream open.
+//
+// Each point is a capture select word (program step << 2 | register, as
+// exported for a SigmaStudio readback cell). Up to two points stay armed
+// in the two capture registers; more are multiplexed in pairs, re-armed
+// every sample.
+//
+// Frame: 'L', word count, uint16 sequence (big-endian), uint32 sample time
+// in microseconds (big-endian), then 4 bytes (5.23, big-endian) per point.
+#define LEVEL_STREAM_MAX_WORDS    16
+#define LEVEL_CAPTURE_SETTLE_US   25     // One sample period at 48 kHz, plus margin
+#define LEVEL_STREAM_MAX_CLIENTS  4
+#define LEVEL_STREAM_DEFAULT_HZ   50
+#define LEVEL_STREAM_MAX_HZ       100
+#define LEVEL_STREAM_FRAME_MAGIC  'L'
+
+struct LevelStreamStats {
+  uint16_t words;
+  uint16_t rateHz;          // Configured rate
+  uint8_t clients;
+  uint32_t frames;
+  uint32_t readFailures;
+  uint32_t droppedClients;
+  float sustainedHz;        // Frames per second since streaming started
+  uint32_t avgJitterUs;     // Mean |interval - period|
+  uint32_t maxJitterUs;
+  uint32_t lastReadUs;      // Bus time of the last sample
+};
+
+// Replace the watched capture selects; rateHz 1..LEVEL_STREAM_MAX_HZ
+bool level_stream_configure(const uint16_t* captures, size_t count, uint16_t rateHz);
+
+// Take over the current request's connection as a stream client
+bool level_stream_addClient(WiFiClient client);
+
+// Sample and push when due (call from loop())
+void level_stream_service();
+bool level_stream_active();
+
+LevelStreamStats level_stream_getStats();
+
+#endif // LEVEL_STREAM_H
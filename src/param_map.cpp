@@ -0,0 +1,204 @@
+#include "param_map.h"
+#include "dsp_helper.h"
+#include <Preferences.h>
+
+#define PARAM_MAP_NAMESPACE "param_map"
+#define PARAM_MAP_KEY       "entries"
+#define PARAM_MAP_ADDR_NONE 0xFFFF     // Collided name - never resolves
+
+struct ParamMapEntry {
+  uint32_t hash;
+  uint16_t address;
+} __attribute__((packed));
+
+static ParamMapEntry mapEntries[PARAM_MAP_MAX_ENTRIES];
+static uint16_t mapCount = 0;
+static uint16_t mapIndex[PARAM_MAP_INDEX_SIZE];   // Entry index + 1, 0 = empty
+
+static ParamMapImportStats importStats;
+static char importLine[PARAM_MAP_LINE_MAX];
+static size_t importLineLen = 0;
+static bool importLineOverflow = false;
+
+// FNV-1a over the name, excluding a trailing "_ADDR"
+static uint32_t paramNameHash(const char* name, size_t length) {
+  if (length > 5 && strncmp(name + length - 5, "_ADDR", 5) == 0) {
+    length -= 5;
+  }
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (uint8_t)name[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static int findEntry(uint32_t hash) {
+  for (uint16_t probe = 0; probe < PARAM_MAP_INDEX_SIZE; probe++) {
+    uint16_t slot = mapIndex[(hash + probe) & (PARAM_MAP_INDEX_SIZE - 1)];
+    if (slot == 0) {
+      return -1;
+    }
+    if (mapEntries[slot - 1].hash == hash) {
+      return slot - 1;
+    }
+  }
+  return -1;
+}
+
+static void rebuildIndex() {
+  memset(mapIndex, 0, sizeof(mapIndex));
+  for (uint16_t i = 0; i < mapCount; i++) {
+    uint32_t pos = mapEntries[i].hash;
+    while (mapIndex[pos & (PARAM_MAP_INDEX_SIZE - 1)] != 0) {
+      pos++;
+    }
+    mapIndex[pos & (PARAM_MAP_INDEX_SIZE - 1)] = i + 1;
+  }
+}
+
+// Insert during import; the index is kept live so duplicates are found
+static void addEntry(const char* name, size_t nameLen, uint16_t address) {
+  uint32_t hash = paramNameHash(name, nameLen);
+  int existing = findEntry(hash);
+
+  if (existing >= 0) {
+    // Same hash and address is a repeated define; a different address
+    // means two names collide and cannot be told apart - drop the entry
+    if (mapEntries[existing].address != address) {
+      mapEntries[existing].address = PARAM_MAP_ADDR_NONE;
+      importStats.collisions++;
+    }
+    return;
+  }
+
+  if (mapCount >= PARAM_MAP_MAX_ENTRIES) {
+    importStats.skipped++;
+    return;
+  }
+
+  mapEntries[mapCount].hash = hash;
+  mapEntries[mapCount].address = address;
+  mapCount++;
+
+  uint32_t pos = hash;
+  while (mapIndex[pos & (PARAM_MAP_INDEX_SIZE - 1)] != 0) {
+    pos++;
+  }
+  mapIndex[pos & (PARAM_MAP_INDEX_SIZE - 1)] = mapCount;
+}
+
+// "#define MOD_VOL_ALG0_TARGET_ADDR   12" -> entry; other lines ignored
+static void importParseLine(char* line) {
+  importStats.lines++;
+
+  char* p = line;
+  while (*p == ' ' || *p == '\t') p++;
+  if (strncmp(p, "#define", 7) != 0) return;
+  p += 7;
+  while (*p == ' ' || *p == '\t') p++;
+
+  char* name = p;
+  while (*p && *p != ' ' && *p != '\t') p++;
+  size_t nameLen = p - name;
+  if (nameLen <= 5 || strncmp(name + nameLen - 5, "_ADDR", 5) != 0) return;
+
+  while (*p == ' ' || *p == '\t') p++;
+  char* end;
+  unsigned long address = strtoul(p, &end, 0);
+  if (end == p || address >= ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+    importStats.skipped++;  // Program/register targets and non-numeric values
+    return;
+  }
+
+  addEntry(name, nameLen, (uint16_t)address);
+}
+
+void param_map_beginImport() {
+  memset(&importStats, 0, sizeof(importStats));
+  memset(mapIndex, 0, sizeof(mapIndex));
+  mapCount = 0;
+  importLineLen = 0;
+  importLineOverflow = false;
+}
+
+void param_map_processChunk(const char* chunk, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    char c = chunk[i];
+    if (c == '\n' || c == '\r') {
+      if (importLineLen > 0 && !importLineOverflow) {
+        importLine[importLineLen] = '\0';
+        importParseLine(importLine);
+      }
+      importLineLen = 0;
+      importLineOverflow = false;
+    } else if (importLineLen < PARAM_MAP_LINE_MAX - 1) {
+      importLine[importLineLen++] = c;
+    } else {
+      importLineOverflow = true;  // Long comment lines are not defines
+    }
+  }
+}
+
+bool param_map_endImport() {
+  if (importLineLen > 0 && !importLineOverflow) {
+    importLine[importLineLen] = '\0';
+    importParseLine(importLine);
+    importLineLen = 0;
+  }
+
+  importStats.entries = mapCount;
+  if (mapCount == 0) {
+    Serial.println("Param map: no _ADDR defines found, keeping stored map");
+    param_map_load();
+    return false;
+  }
+
+  Preferences prefs;
+  prefs.begin(PARAM_MAP_NAMESPACE, false);
+  size_t size = mapCount * sizeof(ParamMapEntry);
+  bool ok = prefs.putBytes(PARAM_MAP_KEY, mapEntries, size) == size;
+  prefs.end();
+
+  Serial.printf("Param map: %u names, %u collisions, %u skipped (%s)\n",
+                mapCount, importStats.collisions, importStats.skipped,
+                ok ? "saved" : "NOT saved");
+  return ok;
+}
+
+const ParamMapImportStats& param_map_getImportStats() {
+  return importStats;
+}
+
+bool param_map_load() {
+  Preferences prefs;
+  prefs.begin(PARAM_MAP_NAMESPACE, true);
+  size_t size = prefs.getBytesLength(PARAM_MAP_KEY);
+  mapCount = 0;
+  if (size > 0 && size % sizeof(ParamMapEntry) == 0 && size <= sizeof(mapEntries) &&
+      prefs.getBytes(PARAM_MAP_KEY, mapEntries, size) == size) {
+    mapCount = size / sizeof(ParamMapEntry);
+  }
+  prefs.end();
+
+  rebuildIndex();
+  if (mapCount > 0) {
+    Serial.printf("Param map: %u names loaded\n", mapCount);
+  }
+  return mapCount > 0;
+}
+
+bool param_map_lookup(const char* name, uint16_t& address) {
+  if (!name || mapCount == 0) return false;
+
+  int entry = findEntry(paramNameHash(name, strlen(name)));
+  if (entry < 0 || mapEntries[entry].address == PARAM_MAP_ADDR_NONE) {
+    return false;
+  }
+  address = mapEntries[entry].address;
+  return true;
+}
+
+uint16_t param_map_count() {
+  return mapCount;
+}
@@ -0,0 +1,35 @@
+#ifndef PARAM_MAP_H
+#define PARAM_MAP_H
+
+#include <Arduino.h>
+
+// Name -> parameter RAM address map, imported from SigmaStudio's
+// exported parameter header (*_IC_1_PARAM.h, "#define <NAME>_ADDR <n>").
+// Only 32-bit name hashes are kept (flash and RAM), so lookup is O(1)
+// through an open-addressing index rebuilt at load.
+#define PARAM_MAP_MAX_ENTRIES 1024
+#define PARAM_MAP_INDEX_SIZE  2048   // Power of two, >= 2x entries
+#define PARAM_MAP_LINE_MAX    160
+
+struct ParamMapImportStats {
+  uint16_t entries;         // Names in the map
+  uint16_t collisions;      // Distinct names sharing a hash (made unresolvable)
+  uint16_t skipped;         // _ADDR defines rejected (bad value, table full)
+  uint32_t lines;
+};
+
+// Streaming import of an exported parameter header; endImport builds the
+// index and persists it to NVS. On failure the stored map is reloaded.
+void param_map_beginImport();
+void param_map_processChunk(const char* chunk, size_t length);
+bool param_map_endImport();
+const ParamMapImportStats& param_map_getImportStats();
+
+// Load the stored map at boot
+bool param_map_load();
+
+// Resolve a cell/parameter name (with or without the _ADDR suffix)
+bool param_map_lookup(const char* name, uint16_t& address);
+uint16_t param_map_count();
+
+#endif // PARAM_MAP_H
@@ -0,0 +1,93 @@
+#include "param_queue.h"
+#include "dsp_helper.h"
+#include <Arduino.h>
+
+struct ParamQueueEntry {
+  uint16_t address;
+  int32_t value;
+  uint32_t queuedMs;        // When the slot became pending
+  bool pending;
+};
+
+static ParamQueueEntry queueEntries[PARAM_QUEUE_SIZE];
+static ParamQueueStats queueStats;
+static uint8_t drainCursor = 0;  // Round-robin start so busy slots cannot starve others
+
+bool param_queue_push(uint16_t address, int32_t value) {
+  queueStats.received++;
+
+  if (address >= ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+    queueStats.rejected++;
+    return false;
+  }
+
+  int freeSlot = -1;
+  for (int i = 0; i < PARAM_QUEUE_SIZE; i++) {
+    ParamQueueEntry& e = queueEntries[i];
+    if (e.pending && e.address == address) {
+      e.value = value;  // Newer value wins, keep original queue time
+      queueStats.coalesced++;
+      return true;
+    }
+    if (!e.pending && freeSlot < 0) {
+      freeSlot = i;
+    }
+  }
+
+  if (freeSlot < 0) {
+    queueStats.rejected++;
+    return false;
+  }
+
+  ParamQueueEntry& e = queueEntries[freeSlot];
+  e.address = address;
+  e.value = value;
+  e.queuedMs = millis();
+  e.pending = true;
+  queueStats.pending++;
+  return true;
+}
+
+void param_queue_service() {
+  unsigned long startTime = micros();
+
+  while (queueStats.pending > 0) {
+    DSPParamWrite batch[ADAU1701_SAFELOAD_SLOTS];
+    uint8_t slots[ADAU1701_SAFELOAD_SLOTS];
+    size_t n = 0;
+
+    for (int i = 0; i < PARAM_QUEUE_SIZE && n < ADAU1701_SAFELOAD_SLOTS; i++) {
+      uint8_t idx = (drainCursor + i) % PARAM_QUEUE_SIZE;
+      if (queueEntries[idx].pending) {
+        batch[n].address = queueEntries[idx].address;
+        batch[n].value = queueEntries[idx].value;
+        slots[n++] = idx;
+      }
+    }
+    drainCursor = (slots[n - 1] + 1) % PARAM_QUEUE_SIZE;
+
+    if (!dsp_safeloadParams(batch, n)) {
+      queueStats.failures++;
+      return;  // Retry on the next service call
+    }
+
+    uint32_t now = millis();
+    for (size_t i = 0; i < n; i++) {
+      ParamQueueEntry& e = queueEntries[slots[i]];
+      e.pending = false;
+      queueStats.lastLatencyMs = now - e.queuedMs;
+      queueStats.maxLatencyMs = max(queueStats.maxLatencyMs, queueStats.lastLatencyMs);
+    }
+    queueStats.pending -= n;
+    queueStats.applied += n;
+    queueStats.transfers++;
+
+    if (micros() - startTime > PARAM_QUEUE_SERVICE_BUDGET_US) {
+      break;
+    }
+  }
+}
+
+const ParamQueueStats& param_queue_getStats() {
+  return queueStats;
+}
@@ -0,0 +1,33 @@
+#ifndef PARAM_QUEUE_H
+#define PARAM_QUEUE_H
+
+#include <Arduino.h>
+
+// Pending parameter slots - one per distinct address, so the queue
+// length (and thus update latency) is bounded regardless of input rate
+#define PARAM_QUEUE_SIZE            64
+// Time the loop-driven drainer may spend per service call
+#define PARAM_QUEUE_SERVICE_BUDGET_US 5000
+
+struct ParamQueueStats {
+  uint32_t received;        // Updates pushed
+  uint32_t coalesced;       // Updates that replaced a pending value
+  uint32_t rejected;        // Updates dropped because the queue was full
+  uint32_t applied;         // Parameter words written to the DSP
+  uint32_t transfers;       // Safeload transfers issued
+  uint32_t failures;        // Failed transfers (values stay pending)
+  uint16_t pending;
+  uint32_t lastLatencyMs;   // Queue-to-DSP time of the last applied value
+  uint32_t maxLatencyMs;
+};
+
+// Latest-wins update: overwrites a pending value for the same address.
+// Returns false if the address is invalid or every slot is in use.
+bool param_queue_push(uint16_t address, int32_t value);
+
+// Drain pending updates through batched safeload (call from loop())
+void param_queue_service();
+
+const ParamQueueStats& param_queue_getStats();
+
+#endif // PARAM_QUEUE_H
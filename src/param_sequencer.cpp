@@ -0,0 +1,169 @@
+#include "param_sequencer.h"
+#include "dsp_helper.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static SeqEvent seqEvents[SEQ_MAX_EVENTS];
+static uint16_t seqCount = 0;
+static volatile uint16_t seqNext = 0;
+static volatile bool seqRunning = false;
+static volatile uint16_t seqTransfers = 0;
+static int64_t seqStartUs = 0;
+static esp_timer_handle_t seqTimer = nullptr;
+static SemaphoreHandle_t seqLock = nullptr;    // Held by the callback while it uses seqEvents
+
+static void seqArmNext() {
+  if (!seqRunning || seqNext >= seqCount) {
+    seqRunning = false;
+    return;
+  }
+  int64_t delayUs = seqStartUs + seqEvents[seqNext].offsetUs - esp_timer_get_time();
+  esp_timer_start_once(seqTimer, delayUs > 0 ? (uint64_t)delayUs : 1);
+}
+
+// Runs in the esp_timer task - apply every event that is due, then re-arm
+static void seqTimerCallback(void* arg) {
+  xSemaphoreTake(seqLock, portMAX_DELAY);
+  if (!seqRunning) {
+    xSemaphoreGive(seqLock);
+    return;
+  }
+
+  int64_t elapsed = esp_timer_get_time() - seqStartUs;
+  DSPParamWrite batch[ADAU1701_SAFELOAD_SLOTS];
+  uint16_t first = seqNext;
+  size_t n = 0;
+  while (seqNext < seqCount && n < ADAU1701_SAFELOAD_SLOTS &&
+         seqEvents[seqNext].offsetUs <= elapsed + SEQ_COALESCE_US) {
+    batch[n].address = seqEvents[seqNext].address;
+    batch[n].value = seqEvents[seqNext].value;
+    n++;
+    seqNext++;
+  }
+
+  if (n > 0) {
+    uint8_t bus;
+    bool locked = dsp_busTryLock(SEQ_BUS_WAIT_MS, bus);
+    bool ok = locked && dsp_safeloadParams(batch, n);
+    if (locked) {
+      dsp_busUnlock(bus);
+    }
+    int64_t applied = esp_timer_get_time() - seqStartUs;
+    for (uint16_t i = first; i < first + n; i++) {
+      seqEvents[i].errorUs = (int32_t)(applied - seqEvents[i].offsetUs);
+      seqEvents[i].ok = ok;
+      seqEvents[i].busBusy = !locked;
+      seqEvents[i].done = true;
+    }
+    seqTransfers++;
+  }
+
+  seqArmNext();
+  xSemaphoreGive(seqLock);
+}
+
+void seq_clear() {
+  seq_stop();
+  seqCount = 0;
+}
+
+bool seq_addEvent(uint32_t offsetUs, uint16_t address, int32_t value) {
+  if (seqRunning || seqCount >= SEQ_MAX_EVENTS ||
+      address >= ADAU1701_PARAM_RAM_START + ADAU1701_PARAM_RAM_WORDS) {
+    return false;
+  }
+  SeqEvent& e = seqEvents[seqCount++];
+  e.offsetUs = offsetUs;
+  e.address = address;
+  e.value = value;
+  e.errorUs = 0;
+  e.done = false;
+  e.ok = false;
+  e.busBusy = false;
+  return true;
+}
+
+bool seq_start() {
+  if (seqCount == 0) return false;
+
+  if (seqLock == nullptr) {
+    seqLock = xSemaphoreCreateMutex();
+  }
+  if (seqTimer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = seqTimerCallback;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "param_seq";
+    if (esp_timer_create(&args, &seqTimer) != ESP_OK) {
+      Serial.println("Sequencer: timer create failed");
+      return false;
+    }
+  }
+  seq_stop();
+
+  // Insertion sort - schedules arrive nearly sorted
+  for (uint16_t i = 1; i < seqCount; i++) {
+    SeqEvent e = seqEvents[i];
+    int j = i - 1;
+    while (j >= 0 && seqEvents[j].offsetUs > e.offsetUs) {
+      seqEvents[j + 1] = seqEvents[j];
+      j--;
+    }
+    seqEvents[j + 1] = e;
+  }
+  for (uint16_t i = 0; i < seqCount; i++) {
+    seqEvents[i].done = false;
+    seqEvents[i].ok = false;
+    seqEvents[i].busBusy = false;
+    seqEvents[i].errorUs = 0;
+  }
+
+  seqNext = 0;
+  seqTransfers = 0;
+  seqStartUs = esp_timer_get_time() + SEQ_START_LEAD_US;
+  seqRunning = true;
+  seqArmNext();
+
+  Serial.printf("Sequencer: %u events over %lu ms\n", seqCount,
+                (unsigned long)(seqEvents[seqCount - 1].offsetUs / 1000));
+  return true;
+}
+
+// Returns once no callback is touching seqEvents, so the caller may
+// rewrite the schedule
+void seq_stop() {
+  seqRunning = false;
+  if (seqTimer) {
+    esp_timer_stop(seqTimer);
+  }
+  if (seqLock) {
+    xSemaphoreTake(seqLock, portMAX_DELAY);   // Wait out an in-flight callback
+    xSemaphoreGive(seqLock);
+  }
+}
+
+SeqSummary seq_getSummary() {
+  SeqSummary s = {};
+  s.running = seqRunning;
+  s.events = seqCount;
+  s.transfers = seqTransfers;
+
+  int64_t errorSum = 0;
+  for (uint16_t i = 0; i < seqCount; i++) {
+    if (!seqEvents[i].done) continue;
+    s.completed++;
+    if (!seqEvents[i].ok) s.failed++;
+    if (seqEvents[i].busBusy) s.busBusy++;
+    int32_t err = abs(seqEvents[i].errorUs);
+    errorSum += err;
+    s.maxErrorUs = max(s.maxErrorUs, err);
+  }
+  s.avgErrorUs = s.completed ? (int32_t)(errorSum / s.completed) : 0;
+  return s;
+}
+
+const SeqEvent* seq_getEvents(uint16_t& count) {
+  count = seqCount;
+  return seqEvents;
+}
@@ -0,0 +1,46 @@
+#ifndef PARAM_SEQUENCER_H
+#define PARAM_SEQUENCER_H
+
+#include <Arduino.h>
+
+// Timed parameter automation: events run from an esp_timer callback
+// through batched safeload. Events due within SEQ_COALESCE_US of each
+// other share one safeload transfer. The callback shares the esp_timer
+// task, so it never waits more than SEQ_BUS_WAIT_MS for the DSP bus;
+// events that find it busy longer are dropped and marked busBusy.
+#define SEQ_MAX_EVENTS     256
+#define SEQ_START_LEAD_US  10000   // Delay from start request to t = 0
+#define SEQ_COALESCE_US    500
+#define SEQ_BUS_WAIT_MS    2       // Longest the timer task waits for the DSP bus
+
+struct SeqEvent {
+  uint32_t offsetUs;        // Scheduled time from sequence start
+  uint16_t address;
+  int32_t value;            // 5.23 fixed point
+  int32_t errorUs;          // Safeload completion minus scheduled time
+  bool done;
+  bool ok;
+  bool busBusy;             // Dropped: DSP bus held past SEQ_BUS_WAIT_MS
+};
+
+struct SeqSummary {
+  bool running;
+  uint16_t events;
+  uint16_t completed;
+  uint16_t failed;
+  uint16_t busBusy;         // Failed events dropped on a busy bus
+  uint16_t transfers;
+  int32_t maxErrorUs;       // Largest absolute timing error
+  int32_t avgErrorUs;       // Mean absolute timing error
+};
+
+// Build a schedule (sorted by time on start), then run it
+void seq_clear();
+bool seq_addEvent(uint32_t offsetUs, uint16_t address, int32_t value);
+bool seq_start();
+void seq_stop();
+
+SeqSummary seq_getSummary();
+const SeqEvent* seq_getEvents(uint16_t& count);
+
+#endif // PARAM_SEQUENCER_H
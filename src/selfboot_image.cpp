@@ -0,0 +1,203 @@
+#include "selfboot_image.h"
+#include "config.h"
+#include "dsp_helper.h"
+#include "eeprom_manager.h"
+#include <Arduino.h>
+
+// Message walker state
+enum SelfBootState {
+  SB_STATE_TYPE,
+  SB_STATE_LEN_HI,
+  SB_STATE_LEN_LO,
+  SB_STATE_DEVICE,
+  SB_STATE_SUB_HI,
+  SB_STATE_SUB_LO,
+  SB_STATE_DATA,
+  SB_STATE_DELAY_HI,
+  SB_STATE_DELAY_LO,
+  SB_STATE_DONE
+};
+
+static SelfBootState sbState = SB_STATE_TYPE;
+static SelfBootImageInfo sbInfo;
+static uint32_t sbOffset = 0;
+static uint16_t sbMsgLen = 0;
+static uint16_t sbSubaddress = 0;
+static uint16_t sbDataRemaining = 0;
+static SelfBootRegion* sbRegions = nullptr;
+static uint8_t sbMaxRegions = 0;
+static uint16_t sbRegionCount = 0;
+
+static void selfbootFail(const char* msg) {
+  sbInfo.error = msg;
+  sbInfo.errorOffset = sbOffset;
+  sbInfo.valid = false;
+  sbState = SB_STATE_DONE;
+}
+
+// Check a write's target range against the ADAU1701 memory map and
+// account its data bytes to the matching memory.
+static bool selfbootCheckWrite(uint16_t subaddress, uint16_t dataBytes) {
+  if (subaddress < ADAU1701_PROG_RAM_START) {
+    if (dataBytes % ADAU1701_PARAM_WORD_BYTES != 0 ||
+        subaddress + dataBytes / ADAU1701_PARAM_WORD_BYTES > ADAU1701_PROG_RAM_START) {
+      return false;
+    }
+    sbInfo.paramBytes += dataBytes;
+  } else if (subaddress < ADAU1701_HW_REG_START) {
+    if (dataBytes % ADAU1701_PROG_WORD_BYTES != 0 ||
+        subaddress + dataBytes / ADAU1701_PROG_WORD_BYTES > ADAU1701_HW_REG_START) {
+      return false;
+    }
+    sbInfo.programBytes += dataBytes;
+  } else {
+    if (subaddress > ADAU1701_HW_REG_END) {
+      return false;
+    }
+    sbInfo.registerBytes += dataBytes;
+  }
+  return true;
+}
+
+void selfboot_begin() {
+  memset(&sbInfo, 0, sizeof(sbInfo));
+  sbState = SB_STATE_TYPE;
+  sbOffset = 0;
+  sbMsgLen = 0;
+  sbSubaddress = 0;
+  sbDataRemaining = 0;
+  sbRegionCount = 0;
+}
+
+void selfboot_setRegionLog(SelfBootRegion* regions, uint8_t maxRegions) {
+  sbRegions = regions;
+  sbMaxRegions = regions ? maxRegions : 0;
+}
+
+uint16_t selfboot_getRegionCount() {
+  return sbRegionCount;
+}
+
+bool selfboot_feed(const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length && sbState != SB_STATE_DONE; i++) {
+    uint8_t b = data[i];
+
+    switch (sbState) {
+      case SB_STATE_TYPE:
+        if (b == ADAU1701_BOOT_MSG_END) {
+          sbInfo.complete = true;
+          sbInfo.valid = (sbInfo.error == nullptr);
+          sbInfo.imageLength = sbOffset + 1;
+          sbState = SB_STATE_DONE;
+        } else if (b == ADAU1701_BOOT_MSG_WRITE) {
+          sbInfo.writeMessages++;
+          sbState = SB_STATE_LEN_HI;
+        } else if (b == ADAU1701_BOOT_MSG_DELAY) {
+          sbInfo.delayMessages++;
+          sbState = SB_STATE_DELAY_HI;
+        } else if (b == ADAU1701_BOOT_MSG_NOP) {
+          sbInfo.nopMessages++;
+        } else {
+          selfbootFail(b == 0xFF ? "Blank EEPROM (no image)" : "Unknown message type");
+        }
+        break;
+
+      case SB_STATE_LEN_HI:
+        sbMsgLen = (uint16_t)b << 8;
+        sbState = SB_STATE_LEN_LO;
+        break;
+
+      case SB_STATE_LEN_LO:
+        sbMsgLen |= b;
+        // Device address byte + 2-byte subaddress at minimum
+        if (sbMsgLen < 3) {
+          selfbootFail("Write message too short");
+        } else {
+          sbState = SB_STATE_DEVICE;
+        }
+        break;
+
+      case SB_STATE_DEVICE:
+        sbState = SB_STATE_SUB_HI;
+        break;
+
+      case SB_STATE_SUB_HI:
+        sbSubaddress = (uint16_t)b << 8;
+        sbState = SB_STATE_SUB_LO;
+        break;
+
+      case SB_STATE_SUB_LO:
+        sbSubaddress |= b;
+        sbDataRemaining = sbMsgLen - 3;
+        if (!selfbootCheckWrite(sbSubaddress, sbDataRemaining)) {
+          selfbootFail("Write outside DSP memory map");
+        } else {
+          if (sbRegionCount < sbMaxRegions) {
+            sbRegions[sbRegionCount] = {sbSubaddress, sbDataRemaining, sbOffset + 1};
+          }
+          sbRegionCount++;
+          sbState = (sbDataRemaining > 0) ? SB_STATE_DATA : SB_STATE_TYPE;
+        }
+        break;
+
+      case SB_STATE_DATA:
+        if (--sbDataRemaining == 0) {
+          sbState = SB_STATE_TYPE;
+        }
+        break;
+
+      case SB_STATE_DELAY_HI:
+        sbState = SB_STATE_DELAY_LO;
+        break;
+
+      case SB_STATE_DELAY_LO:
+        sbState = SB_STATE_TYPE;
+        break;
+
+      case SB_STATE_DONE:
+        break;
+    }
+
+    sbOffset++;
+  }
+
+  if (sbState != SB_STATE_DONE && sbOffset >= EEPROM_SIZE) {
+    selfbootFail("No END message within EEPROM");
+  }
+
+  return sbState != SB_STATE_DONE;
+}
+
+const SelfBootImageInfo& selfboot_getInfo() {
+  return sbInfo;
+}
+
+SelfBootImageInfo selfboot_analyzeEEPROM() {
+  uint8_t buf[64];
+  unsigned long startTime = millis();
+
+  selfboot_begin();
+  for (uint32_t addr = 0; addr < EEPROM_SIZE; addr += sizeof(buf)) {
+    if (!readBlockFromEEPROM(addr, buf, sizeof(buf))) {
+      sbOffset = addr;
+      selfbootFail("EEPROM read failed");
+      break;
+    }
+    if (!selfboot_feed(buf, sizeof(buf))) {
+      break;
+    }
+    yield();
+  }
+
+  Serial.printf("Self-boot image: %s, %u bytes, %u writes (%lu ms)\n",
+                sbInfo.valid ? "valid" : (sbInfo.error ? sbInfo.error : "incomplete"),
+                sbInfo.imageLength, sbInfo.writeMessages, millis() - startTime);
+  return sbInfo;
+}
+
+uint32_t selfboot_usedRegion(const SelfBootImageInfo& info) {
+  if (!info.valid) {
+    return EEPROM_SIZE;
+  }
+  return min((uint32_t)EEPROM_SIZE, info.imageLength + SELFBOOT_BLANK_MARGIN);
+}
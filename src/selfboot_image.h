@@ -0,0 +1,52 @@
+#ifndef SELFBOOT_IMAGE_H
+#define SELFBOOT_IMAGE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Bytes past the end of the image included in erase/dump ranges, so the
+// region following the END message can be blank-checked.
+#define SELFBOOT_BLANK_MARGIN EEPROM_PAGE_SIZE
+
+// Result of walking an ADAU1701 self-boot image
+struct SelfBootImageInfo {
+  bool complete;            // END message reached
+  bool valid;               // Complete and structurally sound
+  uint32_t imageLength;     // Bytes up to and including the END message
+  uint16_t writeMessages;
+  uint16_t delayMessages;
+  uint16_t nopMessages;
+  uint32_t paramBytes;      // Data bytes targeting parameter RAM
+  uint32_t programBytes;    // Data bytes targeting program RAM
+  uint32_t registerBytes;   // Data bytes targeting control registers
+  uint32_t errorOffset;     // Offset of the first structural error
+  const char* error;        // nullptr if no error
+};
+
+// Extent of one write message: target subaddress and where its data
+// bytes sit in the image
+struct SelfBootRegion {
+  uint16_t subaddress;
+  uint16_t length;          // Data bytes
+  uint32_t dataOffset;      // Image offset of the first data byte
+};
+
+// Streaming analyzer - feed image bytes in order, any chunk size.
+// selfboot_feed returns false once the END message or an error is reached.
+void selfboot_begin();
+bool selfboot_feed(const uint8_t* data, size_t length);
+const SelfBootImageInfo& selfboot_getInfo();
+
+// Optional write-message log filled by the next walk (nullptr to disable).
+// Messages past maxRegions are counted but not logged.
+void selfboot_setRegionLog(SelfBootRegion* regions, uint8_t maxRegions);
+uint16_t selfboot_getRegionCount();
+
+// Analyze the image currently stored in the EEPROM
+SelfBootImageInfo selfboot_analyzeEEPROM();
+
+// Bytes that erase/dump/verify need to touch for the stored image:
+// image length plus the blank-check margin, or EEPROM_SIZE if no valid image.
+uint32_t selfboot_usedRegion(const SelfBootImageInfo& info);
+
+#endif // SELFBOOT_IMAGE_H
@@ -0,0 +1,368 @@
+#include "sigma_import.h"
+#include "config.h"
+#include "dsp_helper.h"
+#include "hex_parser.h"
+#include <Arduino.h>
+
+// Tokenizer state - one pass per character, no line buffering, so
+// chunk boundaries and line lengths do not matter.
+enum SigmaTokenState {
+  SIGMA_TOK_IDLE,
+  SIGMA_TOK_ZERO,          // Saw '0' - either "0x.." or a decimal
+  SIGMA_TOK_HEX,           // Collecting hex digits after "0x"
+  SIGMA_TOK_DEC,           // Collecting decimal digits
+  SIGMA_TOK_SLASH,         // Saw '/' - possible comment start
+  SIGMA_TOK_LINE_COMMENT,
+  SIGMA_TOK_BLOCK_COMMENT,
+  SIGMA_TOK_BLOCK_STAR     // Saw '*' inside block comment
+};
+
+static SigmaTokenState tokState = SIGMA_TOK_IDLE;
+static uint32_t tokValue = 0;
+static uint8_t tokDigits = 0;
+
+// NumBytes transaction table (loaded from NumBytes_IC_1.dat)
+static uint16_t txTable[SIGMA_MAX_TRANSACTIONS];
+static uint16_t txCount = 0;
+static uint16_t fileTableStart = 0;
+static bool tableInvalid = false;     // Entry out of range - reported only if
+static bool tableOverflow = false;    // the decimals turn out to be a table
+
+// TxBuffer conversion state
+static uint16_t txIndex = 0;
+static uint16_t txRemaining = 0;
+
+// Direct DSP download state: each transaction is a 2-byte subaddress
+// followed by data, replayed in word-aligned bursts as it streams in.
+static SigmaTarget target = SIGMA_TARGET_EEPROM;
+static uint16_t dspSubaddress = 0;
+static uint8_t dspHeaderBytes = 0;
+static uint8_t dspBurst[DSP_BURST_MAX_DATA];
+static size_t dspBurstLen = 0;
+static uint32_t dspBytes = 0;
+
+// Output image state
+static uint32_t imageAddr = 0;
+static SigmaExportType fileType = SIGMA_EXPORT_UNKNOWN;
+static SigmaExportType lastType = SIGMA_EXPORT_UNKNOWN;
+static const char* lastError = nullptr;
+
+static inline int sigmaHexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static void sigmaSetError(const char* msg) {
+  if (lastError == nullptr) {
+    lastError = msg;
+    Serial.printf("SIGMA: %s\n", msg);
+  }
+}
+
+// Append one byte to the EEPROM image through the shared write batch
+static void sigmaEmit(uint8_t value) {
+  if (imageAddr >= EEPROM_SIZE) {
+    if (imageAddr == EEPROM_SIZE) {
+      noteOutOfRangeRecord();
+    }
+    imageAddr++;
+    sigmaSetError("Image exceeds EEPROM size");
+    return;
+  }
+  addToBatch((uint16_t)imageAddr, &value, 1);
+  imageAddr++;
+}
+
+// Send the buffered part of the current transaction and advance its
+// subaddress past the words written
+static void sigmaDspFlush() {
+  if (dspBurstLen == 0) return;
+
+  // Dry run: validate and count the transaction, leave DSP RAM untouched
+  bool ok = true;
+  if (!hex_isDryRun()) {
+    unsigned long start = micros();
+    ok = dsp_writeBlock(dspSubaddress, dspBurst, dspBurstLen);
+    hex_accountSink(micros() - start);  // I2C time, not parse time
+  }
+  if (!ok) {
+    sigmaSetError("DSP burst write failed");
+  } else {
+    dspBytes += dspBurstLen;
+  }
+  size_t wordBytes = dsp_memoryWordBytes(dspSubaddress);
+  if (wordBytes) {
+    dspSubaddress += dspBurstLen / wordBytes;
+  }
+  dspBurstLen = 0;
+}
+
+static void sigmaDspByte(uint8_t value) {
+  if (dspHeaderBytes < 2) {
+    dspSubaddress = (dspSubaddress << 8) | value;
+    dspHeaderBytes++;
+    return;
+  }
+
+  if (dspBurstLen >= sizeof(dspBurst)) {
+    // Only register writes reach here: memory bursts flush when full
+    sigmaSetError("Register write exceeds burst buffer");
+    return;
+  }
+  dspBurst[dspBurstLen++] = value;
+
+  size_t wordBytes = dsp_memoryWordBytes(dspSubaddress);
+  if (wordBytes && dspBurstLen == (DSP_BURST_MAX_DATA / wordBytes) * wordBytes) {
+    sigmaDspFlush();
+  }
+}
+
+static void sigmaOnDecimal(uint32_t value) {
+  if (fileType != SIGMA_EXPORT_UNKNOWN) {
+    return; // Decimals inside a byte stream (e.g. trailing comments) are ignored
+  }
+  // Not validated yet: decimals before the first byte token or '{' may be
+  // a preamble (IC_1, array sizes), judged in sigma_endFile()
+  if (txCount >= SIGMA_MAX_TRANSACTIONS) {
+    tableOverflow = true;
+    return;
+  }
+  if (value < 2 || value > 0xFFFE) {
+    tableInvalid = true;
+    return;
+  }
+  txTable[txCount++] = (uint16_t)value;
+}
+
+// Drop decimals collected so far: they were a preamble, not a NumBytes table
+static void sigmaDiscardPreamble() {
+  txCount = fileTableStart;
+  tableInvalid = false;
+  tableOverflow = false;
+}
+
+static void sigmaOnByte(uint8_t value) {
+  if (fileType == SIGMA_EXPORT_UNKNOWN) {
+    // Decimals seen before the first byte token were a preamble
+    // (array size etc.), not a NumBytes table.
+    sigmaDiscardPreamble();
+    fileType = (txCount > 0) ? SIGMA_EXPORT_TXBUFFER : SIGMA_EXPORT_E2PROM;
+    txIndex = 0;
+    txRemaining = 0;
+    Serial.printf("SIGMA: detected %s\n", sigma_getTypeName(fileType));
+  }
+
+  if (fileType == SIGMA_EXPORT_E2PROM) {
+    if (target == SIGMA_TARGET_DSP) {
+      sigmaSetError("DSP download needs TxBuffer + NumBytes exports");
+      return;
+    }
+    sigmaEmit(value);
+    return;
+  }
+
+  // TxBuffer: wrap each NumBytes-sized transaction in a self-boot write message
+  if (txRemaining == 0) {
+    if (txIndex >= txCount) {
+      sigmaSetError("TxBuffer longer than NumBytes table");
+      return;
+    }
+    uint16_t len = txTable[txIndex++];
+    txRemaining = len;
+    if (target == SIGMA_TARGET_DSP) {
+      dspSubaddress = 0;
+      dspHeaderBytes = 0;
+      dspBurstLen = 0;
+    } else {
+      uint16_t msgLen = len + 1; // Device address byte + subaddress + data
+      sigmaEmit(ADAU1701_BOOT_MSG_WRITE);
+      sigmaEmit((uint8_t)(msgLen >> 8));
+      sigmaEmit((uint8_t)(msgLen & 0xFF));
+      sigmaEmit(ADAU1701_BOOT_DEVICE_ADDR);
+    }
+  }
+
+  txRemaining--;
+  if (target == SIGMA_TARGET_DSP) {
+    sigmaDspByte(value);
+    if (txRemaining == 0) {
+      sigmaDspFlush();
+    }
+  } else {
+    sigmaEmit(value);
+  }
+}
+
+// Complete the token in progress (called on any separator)
+static void sigmaEndToken() {
+  if (tokState == SIGMA_TOK_HEX) {
+    if (tokDigits == 0 || tokDigits > 2) {
+      sigmaSetError("Malformed byte token");
+    } else {
+      sigmaOnByte((uint8_t)tokValue);
+    }
+  } else if (tokState == SIGMA_TOK_DEC || tokState == SIGMA_TOK_ZERO) {
+    sigmaOnDecimal(tokValue);
+  }
+  tokState = SIGMA_TOK_IDLE;
+  tokValue = 0;
+  tokDigits = 0;
+}
+
+void sigma_begin() {
+  txCount = 0;
+  fileTableStart = 0;
+  imageAddr = 0;
+  lastType = SIGMA_EXPORT_UNKNOWN;
+  lastError = nullptr;
+  target = SIGMA_TARGET_EEPROM;
+  dspBytes = 0;
+  sigma_beginFile();
+}
+
+void sigma_beginFile() {
+  // A converted TxBuffer consumes the table it was paired with
+  if (lastType == SIGMA_EXPORT_TXBUFFER) {
+    txCount = 0;
+  }
+  fileTableStart = txCount;
+  tableInvalid = false;
+  tableOverflow = false;
+  fileType = SIGMA_EXPORT_UNKNOWN;
+  tokState = SIGMA_TOK_IDLE;
+  tokValue = 0;
+  tokDigits = 0;
+  txIndex = 0;
+  txRemaining = 0;
+}
+
+void sigma_processChunk(const char* chunk, size_t chunkLen) {
+  for (size_t i = 0; i < chunkLen; i++) {
+    char c = chunk[i];
+
+    switch (tokState) {
+      case SIGMA_TOK_LINE_COMMENT:
+        if (c == '\n') tokState = SIGMA_TOK_IDLE;
+        continue;
+      case SIGMA_TOK_BLOCK_COMMENT:
+        if (c == '*') tokState = SIGMA_TOK_BLOCK_STAR;
+        continue;
+      case SIGMA_TOK_BLOCK_STAR:
+        tokState = (c == '/') ? SIGMA_TOK_IDLE :
+                   (c == '*') ? SIGMA_TOK_BLOCK_STAR : SIGMA_TOK_BLOCK_COMMENT;
+        continue;
+      case SIGMA_TOK_SLASH:
+        if (c == '/') { tokState = SIGMA_TOK_LINE_COMMENT; continue; }
+        if (c == '*') { tokState = SIGMA_TOK_BLOCK_COMMENT; continue; }
+        tokState = SIGMA_TOK_IDLE;
+        break;
+      case SIGMA_TOK_ZERO:
+        if (c == 'x' || c == 'X') { tokState = SIGMA_TOK_HEX; continue; }
+        if (c >= '0' && c <= '9') { tokState = SIGMA_TOK_DEC; tokValue = c - '0'; continue; }
+        sigmaEndToken();
+        break;
+      case SIGMA_TOK_HEX: {
+        int n = sigmaHexNibble(c);
+        if (n >= 0) {
+          tokValue = (tokValue << 4) | n;
+          tokDigits++;
+          continue;
+        }
+        sigmaEndToken();
+        break;
+      }
+      case SIGMA_TOK_DEC:
+        if (c >= '0' && c <= '9') {
+          tokValue = tokValue * 10 + (c - '0');
+          continue;
+        }
+        sigmaEndToken();
+        break;
+      case SIGMA_TOK_IDLE:
+        break;
+    }
+
+    // Idle: look for the start of the next token
+    if (c == '0') {
+      tokState = SIGMA_TOK_ZERO;
+      tokValue = 0;
+    } else if (c >= '1' && c <= '9') {
+      tokState = SIGMA_TOK_DEC;
+      tokValue = c - '0';
+    } else if (c == '/') {
+      tokState = SIGMA_TOK_SLASH;
+    } else if (c == '{' && fileType == SIGMA_EXPORT_UNKNOWN) {
+      sigmaDiscardPreamble();  // C array body starts here
+    }
+  }
+}
+
+void sigma_endFile() {
+  sigmaEndToken();
+
+  if (fileType == SIGMA_EXPORT_UNKNOWN && (txCount > fileTableStart || tableInvalid || tableOverflow)) {
+    fileType = SIGMA_EXPORT_NUMBYTES;
+    if (tableOverflow) {
+      sigmaSetError("Too many NumBytes entries");
+    } else if (tableInvalid) {
+      sigmaSetError("Invalid NumBytes entry");
+    }
+    Serial.printf("SIGMA: NumBytes table loaded, %u transactions\n", txCount);
+  } else if (fileType == SIGMA_EXPORT_TXBUFFER) {
+    if (txRemaining > 0 || txIndex < txCount) {
+      sigmaSetError("TxBuffer shorter than NumBytes table");
+    }
+    if (target == SIGMA_TARGET_DSP) {
+      Serial.printf("SIGMA: TxBuffer downloaded to DSP, %u transactions, %u bytes\n",
+                    txIndex, dspBytes);
+    } else {
+      sigmaEmit(ADAU1701_BOOT_MSG_END);
+      Serial.printf("SIGMA: TxBuffer converted, %u transactions, %u image bytes\n",
+                    txIndex, imageAddr);
+    }
+  } else if (fileType == SIGMA_EXPORT_E2PROM) {
+    Serial.printf("SIGMA: E2Prom image, %u bytes\n", imageAddr);
+  }
+
+  flushBatch();
+  lastType = fileType;
+}
+
+SigmaExportType sigma_getLastType() {
+  return lastType;
+}
+
+const char* sigma_getTypeName(SigmaExportType type) {
+  switch (type) {
+    case SIGMA_EXPORT_E2PROM: return "E2Prom.Hex";
+    case SIGMA_EXPORT_TXBUFFER: return "TxBuffer";
+    case SIGMA_EXPORT_NUMBYTES: return "NumBytes";
+    default: return "unknown";
+  }
+}
+
+uint16_t sigma_getTransactionCount() {
+  return (lastType == SIGMA_EXPORT_TXBUFFER) ? txIndex : txCount;
+}
+
+void sigma_setTarget(SigmaTarget newTarget) {
+  target = newTarget;
+}
+
+SigmaTarget sigma_getTarget() {
+  return target;
+}
+
+uint32_t sigma_getDspBytes() {
+  return dspBytes;
+}
+
+uint32_t sigma_getImageBytes() {
+  return imageAddr;
+}
+
+const char* sigma_getError() {
+  return lastError;
+}
@@ -0,0 +1,44 @@
+#ifndef SIGMA_IMPORT_H
+#define SIGMA_IMPORT_H
+
+#include <Arduino.h>
+
+// SigmaStudio export types, recognised by content
+enum SigmaExportType {
+  SIGMA_EXPORT_UNKNOWN = 0,
+  SIGMA_EXPORT_E2PROM,      // E2Prom.Hex - raw self-boot image bytes ("0x01, 0x00, ...")
+  SIGMA_EXPORT_TXBUFFER,    // TxBuffer_IC_1.dat - concatenated I2C write payloads
+  SIGMA_EXPORT_NUMBYTES     // NumBytes_IC_1.dat - decimal byte count per write
+};
+
+// Where decoded SigmaStudio data goes
+enum SigmaTarget {
+  SIGMA_TARGET_EEPROM = 0,  // Build a self-boot image in the EEPROM
+  SIGMA_TARGET_DSP          // Replay TxBuffer writes straight into DSP RAM/registers
+};
+
+// Maximum number of transactions accepted from NumBytes_IC_1.dat
+#define SIGMA_MAX_TRANSACTIONS 1024
+
+// Reset importer state for a new upload (clears any NumBytes table)
+void sigma_begin();
+
+// Select the output for the next upload (reset to EEPROM by sigma_begin)
+void sigma_setTarget(SigmaTarget target);
+SigmaTarget sigma_getTarget();
+
+// Per-file hooks: a NumBytes file loads the transaction table, and a
+// following TxBuffer file is converted to self-boot write messages.
+void sigma_beginFile();
+void sigma_processChunk(const char* chunk, size_t chunkLen);
+void sigma_endFile();
+
+// Results of the last processed file
+SigmaExportType sigma_getLastType();
+const char* sigma_getTypeName(SigmaExportType type);
+uint16_t sigma_getTransactionCount();
+uint32_t sigma_getImageBytes();
+uint32_t sigma_getDspBytes();
+const char* sigma_getError();
+
+#endif // SIGMA_IMPORT_H
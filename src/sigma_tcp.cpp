@@ -0,0 +1,250 @@
+#include "sigma_tcp.h"
+#include "dsp_helper.h"
+#include <WiFi.h>
+
+enum SigmaTcpState {
+  TCP_STATE_COMMAND,
+  TCP_STATE_HEADER,
+  TCP_STATE_WRITE_DATA,
+  TCP_STATE_SKIP
+};
+
+static WiFiServer tcpServer(SIGMA_TCP_PORT);
+static WiFiClient tcpClient;
+static SigmaTcpStats tcpStats;
+
+static SigmaTcpState tcpState = TCP_STATE_COMMAND;
+static uint8_t tcpHeader[SIGMA_TCP_WRITE_HEADER];
+static uint8_t tcpHeaderLen = 0;
+static uint8_t tcpHeaderNeed = 0;
+static unsigned long tcpCommandStart = 0;
+
+// Write in progress: data is forwarded in word-aligned bursts as it arrives
+static uint16_t writeSubaddress = 0;
+static uint16_t writeRemaining = 0;
+static uint16_t writeSkip = 0;
+static bool writeSafeload = false;
+static bool writeFailed = false;
+static uint8_t writeStage[DSP_BURST_MAX_DATA];
+static uint8_t writeStageLen = 0;
+
+static void commandDone() {
+  uint32_t elapsed = micros() - tcpCommandStart;
+  tcpStats.lastCommandUs = elapsed;
+  tcpStats.maxCommandUs = max(tcpStats.maxCommandUs, elapsed);
+  tcpState = TCP_STATE_COMMAND;
+}
+
+// Bytes to collect before the next burst for the current write
+static uint8_t writeChunkTarget() {
+  size_t wordBytes = dsp_memoryWordBytes(writeSubaddress);
+  size_t maxChunk = wordBytes ? (DSP_BURST_MAX_DATA / wordBytes) * wordBytes : DSP_BURST_MAX_DATA;
+  return (uint8_t)min(maxChunk, (size_t)writeStageLen + writeRemaining);
+}
+
+static void flushWriteStage() {
+  if (writeStageLen == 0) return;
+
+  bool ok;
+  size_t wordBytes = dsp_memoryWordBytes(writeSubaddress);
+  if (writeSafeload && wordBytes == ADAU1701_PARAM_WORD_BYTES) {
+    // Live parameter edits from SigmaStudio go through glitch-free safeload
+    DSPParamWrite params[DSP_BURST_MAX_DATA / ADAU1701_PARAM_WORD_BYTES];
+    size_t count = writeStageLen / ADAU1701_PARAM_WORD_BYTES;
+    for (size_t i = 0; i < count; i++) {
+      const uint8_t* w = &writeStage[i * 4];
+      params[i].address = writeSubaddress + i;
+      params[i].value = (int32_t)(((uint32_t)w[0] << 24) | ((uint32_t)w[1] << 16) |
+                                  ((uint32_t)w[2] << 8) | w[3]);
+    }
+    ok = dsp_safeloadParams(params, count);
+  } else {
+    ok = dsp_writeBlock(writeSubaddress, writeStage, writeStageLen);
+  }
+
+  if (!ok && !writeFailed) {
+    writeFailed = true;
+    tcpStats.errors++;
+    Serial.printf("SigmaTCP: write to 0x%04X failed\n", writeSubaddress);
+  }
+  tcpStats.bytesWritten += writeStageLen;
+  if (wordBytes) {
+    writeSubaddress += writeStageLen / wordBytes;
+  }
+  writeStageLen = 0;
+}
+
+static void serveRead(uint16_t subaddress, uint16_t length) {
+  uint8_t reply[4] = {SIGMA_TCP_CMD_RESPONSE, 0, 4, 1};
+  size_t wordBytes = dsp_memoryWordBytes(subaddress);
+  size_t maxChunk = wordBytes ? (DSP_BURST_MAX_DATA / wordBytes) * wordBytes : DSP_BURST_MAX_DATA;
+  bool valid = length > 0 && length <= SIGMA_TCP_MAX_READ &&
+               (wordBytes ? (length % wordBytes == 0) : (length <= DSP_BURST_MAX_DATA));
+
+  // The status byte precedes the data, so read the first burst up front
+  uint8_t buf[DSP_BURST_MAX_DATA];
+  size_t n = min(maxChunk, (size_t)length);
+  if (!valid || !dsp_readBlock(subaddress, buf, n)) {
+    tcpClient.write(reply, sizeof(reply));  // Error reply, no data
+    tcpStats.errors++;
+    return;
+  }
+
+  uint16_t total = 4 + length;
+  reply[1] = (uint8_t)(total >> 8);
+  reply[2] = (uint8_t)(total & 0xFF);
+  reply[3] = 0;
+  tcpClient.write(reply, sizeof(reply));
+
+  // Data length is fixed by the header - pad with zeros after a later failure
+  bool ok = true;
+  size_t done = 0;
+  while (true) {
+    tcpClient.write(buf, n);
+    done += n;
+    if (done >= length) break;
+
+    n = min(maxChunk, (size_t)(length - done));
+    if (ok && !dsp_readBlock(subaddress + (wordBytes ? done / wordBytes : 0), buf, n)) {
+      ok = false;
+      tcpStats.errors++;
+    }
+    if (!ok) {
+      memset(buf, 0, n);
+    }
+  }
+
+  tcpStats.reads++;
+  tcpStats.bytesRead += length;
+}
+
+static void headerComplete() {
+  if (tcpHeader[0] == SIGMA_TCP_CMD_READ) {
+    uint16_t length = ((uint16_t)tcpHeader[4] << 8) | tcpHeader[5];
+    uint16_t subaddress = ((uint16_t)tcpHeader[6] << 8) | tcpHeader[7];
+    serveRead(subaddress, length);
+    commandDone();
+    return;
+  }
+
+  // Write
+  uint16_t total = ((uint16_t)tcpHeader[3] << 8) | tcpHeader[4];
+  writeRemaining = ((uint16_t)tcpHeader[6] << 8) | tcpHeader[7];
+  writeSubaddress = ((uint16_t)tcpHeader[8] << 8) | tcpHeader[9];
+  writeSafeload = tcpHeader[1] != 0;
+  writeSkip = total > SIGMA_TCP_WRITE_HEADER + writeRemaining ? total - SIGMA_TCP_WRITE_HEADER - writeRemaining : 0;
+  writeFailed = false;
+  writeStageLen = 0;
+  tcpStats.writes++;
+
+  size_t wordBytes = dsp_memoryWordBytes(writeSubaddress);
+  if (wordBytes ? (writeRemaining % wordBytes != 0) : (writeRemaining > DSP_BURST_MAX_DATA)) {
+    Serial.printf("SigmaTCP: unaligned write of %u bytes to 0x%04X\n", writeRemaining, writeSubaddress);
+    writeFailed = true;
+    tcpStats.errors++;
+    writeSkip += writeRemaining;
+    writeRemaining = 0;
+  }
+
+  tcpState = writeRemaining ? TCP_STATE_WRITE_DATA : (writeSkip ? TCP_STATE_SKIP : TCP_STATE_COMMAND);
+  if (tcpState == TCP_STATE_COMMAND) {
+    commandDone();
+  }
+}
+
+// Consume received bytes; several pipelined commands may share one buffer
+static void processBytes(const uint8_t* data, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    switch (tcpState) {
+      case TCP_STATE_COMMAND:
+        tcpCommandStart = micros();
+        tcpHeader[0] = data[i++];
+        tcpHeaderLen = 1;
+        if (tcpHeader[0] == SIGMA_TCP_CMD_WRITE) {
+          tcpHeaderNeed = SIGMA_TCP_WRITE_HEADER;
+        } else if (tcpHeader[0] == SIGMA_TCP_CMD_READ) {
+          tcpHeaderNeed = SIGMA_TCP_READ_HEADER;
+        } else {
+          tcpStats.errors++;  // Unknown command - resync on the next byte
+          break;
+        }
+        tcpState = TCP_STATE_HEADER;
+        break;
+
+      case TCP_STATE_HEADER:
+        tcpHeader[tcpHeaderLen++] = data[i++];
+        if (tcpHeaderLen == tcpHeaderNeed) {
+          headerComplete();
+        }
+        break;
+
+      case TCP_STATE_WRITE_DATA: {
+        uint8_t target = writeChunkTarget();
+        size_t n = min((size_t)(target - writeStageLen), length - i);
+        memcpy(writeStage + writeStageLen, data + i, n);
+        writeStageLen += n;
+        writeRemaining -= n;
+        i += n;
+        if (writeStageLen == target) {
+          flushWriteStage();
+        }
+        if (writeRemaining == 0) {
+          tcpState = writeSkip ? TCP_STATE_SKIP : TCP_STATE_COMMAND;
+          if (tcpState == TCP_STATE_COMMAND) {
+            commandDone();
+          }
+        }
+        break;
+      }
+
+      case TCP_STATE_SKIP: {
+        size_t n = min((size_t)writeSkip, length - i);
+        writeSkip -= n;
+        i += n;
+        if (writeSkip == 0) {
+          commandDone();
+        }
+        break;
+      }
+    }
+  }
+}
+
+void sigma_tcp_begin() {
+  tcpServer.begin();
+  tcpServer.setNoDelay(true);
+  Serial.printf("SigmaTCP server listening on port %d\n", SIGMA_TCP_PORT);
+}
+
+void sigma_tcp_service() {
+  if (tcpServer.hasClient()) {
+    // SigmaStudio reconnects on every link start - newest connection wins
+    if (tcpClient && tcpClient.connected()) {
+      tcpClient.stop();
+    }
+    tcpClient = tcpServer.available();
+    tcpClient.setNoDelay(true);
+    tcpState = TCP_STATE_COMMAND;
+    writeStageLen = 0;
+    tcpStats.connections++;
+    Serial.println("SigmaTCP: client connected");
+  }
+
+  tcpStats.clientConnected = tcpClient && tcpClient.connected();
+  if (!tcpStats.clientConnected) {
+    return;
+  }
+
+  unsigned long startTime = micros();
+  uint8_t buf[256];
+  while (tcpClient.available() > 0 && micros() - startTime < SIGMA_TCP_SERVICE_BUDGET_US) {
+    int n = tcpClient.read(buf, sizeof(buf));
+    if (n <= 0) break;
+    processBytes(buf, n);
+  }
+}
+
+const SigmaTcpStats& sigma_tcp_getStats() {
+  return tcpStats;
+}
@@ -0,0 +1,36 @@
+#ifndef SIGMA_TCP_H
+#define SIGMA_TCP_H
+
+#include <Arduino.h>
+
+// SigmaTCP server (SigmaStudio "TCPIP" channel, ADAU1701 framing).
+// Write: 0x09, safeload, placement, total length (2), chip address,
+//        data length (2), subaddress (2), data
+// Read:  0x0A, total length (2), chip address, data length (2), subaddress (2)
+// Reply: 0x0B, total length (2), status (0 = ok), data
+#define SIGMA_TCP_PORT          8086
+#define SIGMA_TCP_CMD_WRITE     0x09
+#define SIGMA_TCP_CMD_READ      0x0A
+#define SIGMA_TCP_CMD_RESPONSE  0x0B
+#define SIGMA_TCP_WRITE_HEADER  10
+#define SIGMA_TCP_READ_HEADER   8
+#define SIGMA_TCP_MAX_READ      8192    // Largest read request served
+#define SIGMA_TCP_SERVICE_BUDGET_US 20000
+
+struct SigmaTcpStats {
+  bool clientConnected;
+  uint32_t connections;
+  uint32_t writes;
+  uint32_t reads;
+  uint32_t bytesWritten;    // Data bytes written to the DSP
+  uint32_t bytesRead;       // Data bytes returned to SigmaStudio
+  uint32_t errors;          // Protocol or bus errors
+  uint32_t lastCommandUs;   // Header received -> command complete
+  uint32_t maxCommandUs;
+};
+
+void sigma_tcp_begin();
+void sigma_tcp_service();   // Call from loop()
+const SigmaTcpStats& sigma_tcp_getStats();
+
+#endif // SIGMA_TCP_H
@@ -1,5 +1,7 @@
 #include "system_routes.h"
+#include "config.h"
 #include "eeprom_manager.h"
+#include "i2c_bus.h"
 #include <ArduinoJson.h>
 #include <WebServer.h>
 
@@ -15,9 +17,18 @@ void handleHeap() {
   sendJson(200, doc);
 }
 
+// ?bus=N, default the EEPROM bus
 void handleI2CScan() {
   JsonDocument doc;
-  doc["found"] = i2c_scan();
+  uint8_t bus = g_server->hasArg("bus") ? g_server->arg("bus").toInt() : EEPROM_BUS;
+  if (!i2c_busActive(bus)) {
+    doc["success"] = false;
+    doc["message"] = "Bus not active";
+    sendJson(400, doc);
+    return;
+  }
+  doc["bus"] = bus;
+  doc["found"] = i2c_scan(bus);
   sendJson(200, doc);
 }
 
@@ -35,10 +46,82 @@ void handleProgress() {
   sendJson(200, doc);
 }
 
+void handleI2CBusList() {
+  JsonDocument doc;
+  doc["success"] = true;
+  JsonArray buses = doc["buses"].to<JsonArray>();
+  for (uint8_t b = 0; b < I2C_BUS_COUNT; b++) {
+    I2CBusInfo info = i2c_getBusInfo(b);
+    JsonObject o = buses.add<JsonObject>();
+    o["active"] = info.active;
+    o["sda"] = info.sda;
+    o["scl"] = info.scl;
+    o["base_clock"] = info.baseClockHz;
+    o["clock"] = info.clockHz;
+    o["jobs"] = info.jobs;
+    o["job_running"] = info.jobRunning;
+    o["lock_waits"] = info.lockWaits;
+    o["max_lock_wait_us"] = info.maxLockWaitUs;
+  }
+  JsonObject devices = doc["devices"].to<JsonObject>();
+  for (uint8_t d = 0; d < I2C_DEVICE_COUNT; d++) {
+    devices[i2c_deviceName((I2CDevice)d)] = i2c_deviceBus((I2CDevice)d);
+  }
+  sendJson(200, doc);
+}
+
+// {"bus":1,"sda":16,"scl":18,"clock":400000} brings a bus up, {"bus":1,
+// "enabled":false} releases Wire1 (e.g. for the EEPROM emulator);
+// {"devices":{"eeprom":1}} routes device classes
+void handleI2CBuses() {
+  JsonDocument doc;
+  JsonDocument req;
+  if (!g_server->hasArg("plain") || deserializeJson(req, g_server->arg("plain"))) {
+    doc["success"] = false;
+    doc["message"] = "Invalid JSON";
+    sendJson(400, doc);
+    return;
+  }
+
+  if (!req["bus"].isNull()) {
+    uint8_t bus = req["bus"];
+    bool ok = false;
+    if (req["enabled"] | true) {
+      ok = i2c_busBegin(bus, req["sda"] | -1, req["scl"] | -1, req["clock"] | I2C_CLOCK_HZ);
+    } else if (i2c_busIdle(bus)) {
+      ok = i2c_busEnd(bus);
+    }
+    if (!ok) {
+      doc["success"] = false;
+      doc["message"] = "Bus configuration failed (pins, busy, or Wire1 owned by the emulator)";
+      sendJson(400, doc);
+      return;
+    }
+  }
+
+  for (JsonPair kv : req["devices"].as<JsonObject>()) {
+    bool found = false;
+    for (uint8_t d = 0; d < I2C_DEVICE_COUNT; d++) {
+      if (strcmp(kv.key().c_str(), i2c_deviceName((I2CDevice)d)) == 0) {
+        found = i2c_setDeviceBus((I2CDevice)d, kv.value().as<uint8_t>());
+      }
+    }
+    if (!found) {
+      doc["success"] = false;
+      doc["message"] = "Unknown device, inactive bus, or bus busy";
+      sendJson(400, doc);
+      return;
+    }
+  }
+  handleI2CBusList();
+}
+
 void register_system_routes(WebServer &server) {
   // System operations
   server.on("/heap", HTTP_GET, handleHeap);
   server.on("/i2c_scan", HTTP_GET, handleI2CScan);
   server.on("/i2c_log", HTTP_GET, handleI2CLog);
+  server.on("/i2c_buses", HTTP_GET, handleI2CBusList);
+  server.on("/i2c_buses", HTTP_POST, handleI2CBuses);
   server.on("/progress", HTTP_GET, handleProgress);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 void handleHeap();
 void handleI2CScan();
 void handleI2CLog();
+void handleI2CBusList();
+void handleI2CBuses();
 void handleProgress();
 
 // System routes registration
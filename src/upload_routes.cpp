@@ -2,6 +2,10 @@
 #include "config.h"
 #include "eeprom_manager.h"
 #include "hex_parser.h"
+#include "sigma_import.h"
+#include "selfboot_image.h"
+#include "flash_pipeline.h"
+#include "dsp_helper.h"
 #include <ArduinoJson.h>
 #include <WebServer.h>
 
@@ -12,6 +16,31 @@ extern WebServer *g_server;
 bool g_is_binary_upload = false;
 uint32_t g_binary_current_addr = 0;
 uint32_t g_expected_total_bytes = 0;
+UploadTextFormat g_upload_text_format = UPLOAD_TEXT_PENDING;
+static bool g_upload_session_active = false;
+bool g_upload_dry_run = false;
+bool g_upload_to_dsp = false;
+static unsigned long g_upload_start_ms = 0;
+static bool g_upload_rejected = false;
+static uint32_t g_binary_trimmed_bytes = 0;
+
+// Maximum segments listed in a dry-run memory map response
+static const int DRY_RUN_MAX_SEGMENTS = 32;
+
+// Pick the text pipeline from the first significant character of a file:
+// record formats (':' Intel HEX, 'S' S-record, '@' TI-TXT) and C source
+// (declarations, '{', '#') go to the line parser; SigmaStudio exports start
+// with a number, "0x" or a comment and go to sigma_import.
+static UploadTextFormat detectTextFormat(const uint8_t* buf, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    char c = (char)buf[i];
+    if (isspace((unsigned char)c)) continue;
+    if (c == ':' || c == 'S' || c == '@') return UPLOAD_TEXT_RECORDS;
+    if (isalpha((unsigned char)c) || c == '{' || c == '#' || c == '_') return UPLOAD_TEXT_RECORDS;
+    return UPLOAD_TEXT_SIGMA;
+  }
+  return UPLOAD_TEXT_PENDING;
+}
 
 // Helper functions for file type detection (declared in web_routes.cpp)
 extern bool isHexFile(const String& filename);
@@ -29,6 +58,8 @@ void handleUploadStream() {
       // Detect file type
       g_is_binary_upload = isBinFile(upload.filename);
       g_binary_current_addr = 0;
+      g_binary_trimmed_bytes = 0;
+      selfboot_begin();
 
       // Get expected size
       g_expected_total_bytes = 0;
@@ -41,10 +72,32 @@ void handleUploadStream() {
                    g_is_binary_upload ? "BINARY" : "HEX",
                    g_expected_total_bytes);
 
-      // Setup for upload
-      resetUploadStats();
-      resetWriteProgress();
-      setWriteProtect(false);
+      // Setup for upload (once per request - a SigmaStudio NumBytes/TxBuffer
+      // pair arrives as two files in the same multipart body)
+      g_upload_text_format = UPLOAD_TEXT_PENDING;
+      if (!g_upload_session_active) {
+        g_upload_session_active = true;
+        g_upload_dry_run = (g_server->arg("dryrun") == "1");
+        g_upload_to_dsp = (g_server->arg("target") == "dsp");
+        g_upload_start_ms = millis();
+        g_upload_rejected = false;
+        hex_setDryRun(g_upload_dry_run);
+        if (g_upload_dry_run) {
+          Serial.println("DRY RUN: validating only, no EEPROM writes");
+        }
+        resetUploadStats();
+        sigma_begin();
+        if (g_upload_to_dsp) {
+          // Direct download: SigmaStudio writes go to DSP RAM, EEPROM untouched
+          Serial.println("DSP DOWNLOAD: TxBuffer replayed to ADAU1701 RAM");
+          sigma_setTarget(SIGMA_TARGET_DSP);
+        }
+        resetWriteProgress();
+      }
+      sigma_beginFile();
+      if (!g_upload_dry_run && !g_upload_to_dsp) {
+        setWriteProtect(false);
+      }
 
       if (g_expected_total_bytes > 0) {
         setExpectedTotalBytes(g_expected_total_bytes);
@@ -52,15 +105,48 @@ void handleUploadStream() {
       break;
     }
 
-    case UPLOAD_FILE_WRITE:
-      if (upload.currentSize > 0) {
-        if (g_is_binary_upload) {
+    case UPLOAD_FILE_WRITE: {
+      size_t chunkSize = upload.currentSize;
+
+      if (chunkSize > 0 && g_is_binary_upload) {
+        // Self-boot images are padded to the chip size; only program the
+        // image plus the blank-check margin once its END message is seen.
+        uint32_t fileOffset = g_binary_current_addr + g_binary_trimmed_bytes;
+        selfboot_feed(upload.buf, upload.currentSize);
+        const SelfBootImageInfo& image = selfboot_getInfo();
+        uint32_t limit = image.valid ? selfboot_usedRegion(image) : EEPROM_SIZE;
+        if (fileOffset + chunkSize > limit && fileOffset + chunkSize <= EEPROM_SIZE) {
+          size_t keep = (fileOffset < limit) ? (limit - fileOffset) : 0;
+          g_binary_trimmed_bytes += chunkSize - keep;
+          chunkSize = keep;
+        }
+      }
+
+      if (chunkSize > 0 && g_upload_to_dsp && !g_is_binary_upload &&
+          g_upload_text_format == UPLOAD_TEXT_PENDING) {
+        g_upload_text_format = detectTextFormat(upload.buf, chunkSize);
+      }
+
+      if (chunkSize > 0 && g_upload_to_dsp &&
+          (g_is_binary_upload || g_upload_text_format == UPLOAD_TEXT_RECORDS)) {
+        // Only SigmaStudio exports carry DSP subaddresses
+        g_upload_rejected = true;
+      } else if (chunkSize > 0) {
+        if (g_is_binary_upload && g_upload_dry_run) {
+          // BINARY DRY RUN: map the bytes through the batch without writing
+          if (g_binary_current_addr + chunkSize <= EEPROM_SIZE) {
+            addToBatch(g_binary_current_addr, upload.buf, chunkSize);
+          } else {
+            noteOutOfRangeRecord();
+          }
+          g_binary_current_addr += chunkSize;
+        } else if (g_is_binary_upload) {
           // BINARY MODE: Direct EEPROM write (memory efficient)
-          if (g_binary_current_addr + upload.currentSize <= EEPROM_SIZE) {
-            bool success = writeToEEPROM(g_binary_current_addr, upload.buf, upload.currentSize);
+          if (g_binary_current_addr + chunkSize <= EEPROM_SIZE) {
+            bool success = writeToEEPROM(g_binary_current_addr, upload.buf, chunkSize);
             if (success) {
-              g_binary_current_addr += upload.currentSize;
-              Serial.printf("BIN: wrote %d bytes at 0x%04X\n", upload.currentSize, g_binary_current_addr - upload.currentSize);
+              g_binary_current_addr += chunkSize;
+              Serial.printf("BIN: wrote %d bytes at 0x%04X\n", chunkSize, g_binary_current_addr - chunkSize);
             } else {
               Serial.println("BIN: write failed!");
             }
@@ -68,31 +154,53 @@ void handleUploadStream() {
             Serial.println("BIN: would exceed EEPROM size!");
           }
         } else {
-          // HEX MODE: Use parser (memory intensive)
-          if (ESP.getFreeHeap() > 4000) { // Only process if we have enough memory
-            processHexChunk(reinterpret_cast<const char*>(upload.buf), upload.currentSize);
+          if (g_upload_text_format == UPLOAD_TEXT_PENDING) {
+            g_upload_text_format = detectTextFormat(upload.buf, chunkSize);
+          }
+
+          unsigned long parseStart = micros();
+          if (g_upload_text_format == UPLOAD_TEXT_SIGMA) {
+            // SIGMASTUDIO MODE: byte-level tokenizer, no line buffering
+            sigma_processChunk(reinterpret_cast<const char*>(upload.buf), chunkSize);
+          } else if (ESP.getFreeHeap() > 4000) { // Only process if we have enough memory
+            // HEX MODE: Use record parser
+            processHexChunk(reinterpret_cast<const char*>(upload.buf), chunkSize);
           } else {
             Serial.println("HEX: skipping chunk - low memory");
           }
+          hex_accountChunk(chunkSize, micros() - parseStart);
         }
       }
       break;
+    }
 
     case UPLOAD_FILE_END:
       Serial.println("=== UPLOAD COMPLETED ===");
 
       if (!g_is_binary_upload) {
-        // Finalize HEX upload
-        processHexChunk("", 0); // Flush buffer
+        if (g_upload_text_format == UPLOAD_TEXT_SIGMA) {
+          sigma_endFile();
+        } else {
+          // Finalize HEX upload
+          processHexChunk("", 0); // Flush buffer
+          flushBatch();
+        }
+      } else if (g_upload_dry_run) {
         flushBatch();
       }
 
-      setWriteProtect(true);
+      if (!g_upload_dry_run && !g_upload_to_dsp) {
+        setWriteProtect(true);
+      }
       Serial.printf("Final: %u bytes processed\n", getTotalBytesWritten());
       break;
 
     case UPLOAD_FILE_ABORTED:
       Serial.println("=== UPLOAD ABORTED ===");
+      g_upload_session_active = false;
+      g_upload_dry_run = false;
+      g_upload_to_dsp = false;
+      hex_setDryRun(false);
       setWriteProtect(true);
       break;
 
@@ -101,14 +209,60 @@ void handleUploadStream() {
   }
 }
 
+// Dry-run report: memory map and validation results, nothing was written
+static void addDryRunReport(JsonDocument& doc, bool& success, String& message) {
+  const UploadImageStats& stats = getUploadImageStats();
+
+  doc["dryRun"] = true;
+  doc["bytes"] = stats.uniqueBytes;
+  if (stats.uniqueBytes > 0) {
+    doc["minAddress"] = stats.minAddress;
+    doc["maxAddress"] = stats.maxAddress;
+  }
+  doc["overlapBytes"] = stats.overlapBytes;
+  doc["outOfRangeRecords"] = stats.outOfRangeRecords;
+  doc["checksumErrors"] = stats.checksumErrors;
+  doc["estimatedProgramMs"] = (stats.estimatedWriteUs + 999) / 1000;
+
+  UploadSegment segments[DRY_RUN_MAX_SEGMENTS];
+  int segmentCount = getUploadSegments(segments, DRY_RUN_MAX_SEGMENTS);
+  doc["segmentCount"] = segmentCount;
+  JsonArray map = doc["segments"].to<JsonArray>();
+  for (int i = 0; i < segmentCount && i < DRY_RUN_MAX_SEGMENTS; i++) {
+    JsonObject seg = map.add<JsonObject>();
+    seg["start"] = segments[i].start;
+    seg["length"] = segments[i].length;
+  }
+
+  bool valid = success && stats.uniqueBytes > 0 && stats.overlapBytes == 0 &&
+               stats.outOfRangeRecords == 0 && stats.checksumErrors == 0;
+  if (success && !valid) {
+    message = String("Image rejected: ") + stats.checksumErrors + " checksum errors, " +
+              stats.outOfRangeRecords + " out-of-range records, " +
+              stats.overlapBytes + " overlapping bytes";
+  } else if (valid) {
+    message = String("Dry run OK: ") + stats.uniqueBytes + " bytes, ~" +
+              (unsigned long)((stats.estimatedWriteUs + 999) / 1000) + " ms to program";
+  }
+  success = valid;
+}
+
 void handleUploadComplete() {
   JsonDocument doc;
   uint32_t bytesWritten = getTotalBytesWritten();
 
   bool success = (bytesWritten > 0);
   String message;
+  SigmaExportType sigmaType = sigma_getLastType();
+  const char* sigmaError = sigma_getError();
 
-  if (success) {
+  if (sigmaError != nullptr) {
+    success = false;
+    message = String("SigmaStudio import failed: ") + sigmaError;
+  } else if (sigmaType == SIGMA_EXPORT_NUMBYTES) {
+    success = false;
+    message = "NumBytes table loaded but no TxBuffer file followed";
+  } else if (success) {
     message = String("Upload successful: ") + bytesWritten + " bytes written";
   } else {
     message = "Upload failed - no data processed";
@@ -121,22 +275,209 @@ void handleUploadComplete() {
     }
   }
 
+  if (g_upload_dry_run && g_upload_to_dsp) {
+    // Transactions were parsed and counted; nothing reached the DSP
+    uint32_t dspBytes = sigma_getDspBytes();
+    success = !g_upload_rejected && sigmaError == nullptr &&
+              sigmaType == SIGMA_EXPORT_TXBUFFER && dspBytes > 0;
+    if (g_upload_rejected) {
+      message = "DSP download accepts SigmaStudio TxBuffer + NumBytes exports only";
+    } else if (success) {
+      message = String("Dry run OK: ") + dspBytes + " bytes in " +
+                sigma_getTransactionCount() + " DSP transactions";
+    }
+    doc["dryRun"] = true;
+    doc["target"] = "dsp";
+    doc["dspBytes"] = dspBytes;
+    bytesWritten = 0;
+  } else if (g_upload_dry_run) {
+    addDryRunReport(doc, success, message);
+    bytesWritten = 0;
+  } else if (g_upload_to_dsp) {
+    uint32_t dspBytes = sigma_getDspBytes();
+    success = !g_upload_rejected && sigmaError == nullptr &&
+              sigmaType == SIGMA_EXPORT_TXBUFFER && dspBytes > 0;
+    if (g_upload_rejected) {
+      message = "DSP download accepts SigmaStudio TxBuffer + NumBytes exports only";
+    } else if (success) {
+      message = String("DSP download complete: ") + dspBytes + " bytes in " +
+                (unsigned long)(millis() - g_upload_start_ms) + " ms";
+    } else if (sigmaError == nullptr && sigmaType != SIGMA_EXPORT_NUMBYTES) {
+      message = "DSP download needs TxBuffer + NumBytes exports";
+    }
+    doc["target"] = "dsp";
+    doc["dspBytes"] = dspBytes;
+    doc["downloadMs"] = millis() - g_upload_start_ms;
+    bytesWritten = 0;
+  }
+
   doc["success"] = success;
   doc["bytesWritten"] = bytesWritten;
   doc["message"] = message;
   doc["fileType"] = g_is_binary_upload ? "binary" : "hex";
+  if (g_is_binary_upload && g_binary_trimmed_bytes > 0) {
+    doc["imageLength"] = selfboot_getInfo().imageLength;
+    doc["trimmedBytes"] = g_binary_trimmed_bytes;
+  }
+  if (!g_is_binary_upload) {
+    doc["checksumErrors"] = getChecksumErrors();
+  }
+  if (!g_is_binary_upload) {
+    // Parser throughput, excluding time spent in EEPROM writes
+    const ParserPerfStats& perf = hex_getPerfStats();
+    uint32_t parseUs = perf.totalUs > perf.sinkUs ? perf.totalUs - perf.sinkUs : 0;
+    JsonObject parser = doc["parser"].to<JsonObject>();
+    parser["inputBytes"] = perf.inputBytes;
+    parser["chunks"] = perf.chunks;
+    parser["parseUs"] = parseUs;
+    parser["writeUs"] = perf.sinkUs;
+    parser["bytesPerSec"] = parseUs > 0 ? (uint32_t)((uint64_t)perf.inputBytes * 1000000ULL / parseUs) : 0;
+    parser["heapStart"] = perf.startFreeHeap;
+    parser["heapMin"] = perf.minFreeHeap;
+  }
+  if (sigmaType != SIGMA_EXPORT_UNKNOWN) {
+    doc["fileType"] = "sigmastudio";
+    doc["sigmaExport"] = sigma_getTypeName(sigmaType);
+    doc["transactions"] = sigma_getTransactionCount();
+  }
 
   // Reset upload state
   g_is_binary_upload = false;
   g_binary_current_addr = 0;
   g_expected_total_bytes = 0;
+  g_upload_text_format = UPLOAD_TEXT_PENDING;
+  g_upload_session_active = false;
+  g_upload_dry_run = false;
+  g_upload_to_dsp = false;
+  hex_setDryRun(false);
 
   // Send response using external helper
   extern void sendJson(int code, const JsonDocument& doc);
   sendJson(200, doc);
 }
 
+// PIPELINE UPLOAD - image is buffered, then flashed in one pass on completion
+enum PipelineIntake {
+  PIPELINE_INTAKE_NONE,       // No file part, or the upload was aborted
+  PIPELINE_INTAKE_NO_MEMORY,
+  PIPELINE_INTAKE_OVERFLOW,
+  PIPELINE_INTAKE_READY
+};
+static PipelineIntake g_pipeline_intake = PIPELINE_INTAKE_NONE;
+static size_t g_pipeline_bytes = 0;
+
+void handlePipelineUpload() {
+  HTTPUpload& upload = g_server->upload();
+
+  switch (upload.status) {
+    case UPLOAD_FILE_START:
+      Serial.printf("\n=== PIPELINE UPLOAD: %s ===\n", upload.filename.c_str());
+      g_pipeline_intake = pipeline_begin() ? PIPELINE_INTAKE_READY : PIPELINE_INTAKE_NO_MEMORY;
+      g_pipeline_bytes = 0;
+      break;
+
+    case UPLOAD_FILE_WRITE:
+      if (g_pipeline_intake == PIPELINE_INTAKE_READY) {
+        g_pipeline_bytes += upload.currentSize;
+        if (!pipeline_feed(upload.buf, upload.currentSize)) {
+          Serial.println("PIPELINE: image exceeds EEPROM size");
+          g_pipeline_intake = PIPELINE_INTAKE_OVERFLOW;
+        }
+      }
+      break;
+
+    case UPLOAD_FILE_ABORTED:
+      g_pipeline_intake = PIPELINE_INTAKE_NONE;
+      pipeline_end();
+      break;
+
+    default:
+      break;
+  }
+}
+
+static void addPipelinePhase(JsonObject o, const PipelinePhaseResult& r) {
+  o["ok"] = r.ok;
+  o["skipped"] = r.skipped;
+  o["ms"] = r.ms;
+  o["bytes"] = r.bytes;
+}
+
+// One NDJSON progress line per finished phase
+static void streamPipelinePhase(PipelinePhase phase, const PipelineReport& report) {
+  JsonDocument doc;
+  addPipelinePhase(doc.to<JsonObject>(), report.phases[phase]);
+  doc["phase"] = pipeline_phaseName(phase);
+  String line;
+  serializeJson(doc, line);
+  line += '\n';
+  g_server->sendContent(line);
+}
+
+// Flash the buffered image: ?boot=0 skips self-boot, ?verify_dsp=0 skips the
+// DSP RAM check, ?erase=full blanks the whole chip, ?force=1 rewrites every page.
+// Streams one line per phase, then a summary line with the timing breakdown.
+void handlePipelineComplete() {
+  PipelineIntake intake = g_pipeline_intake;
+  g_pipeline_intake = PIPELINE_INTAKE_NONE;
+  if (intake != PIPELINE_INTAKE_READY || g_pipeline_bytes == 0) {
+    pipeline_end();
+    JsonDocument doc;
+    doc["success"] = false;
+    int code = 400;
+    if (intake == PIPELINE_INTAKE_NO_MEMORY) {
+      doc["message"] = "Not enough memory to buffer the image";
+      code = 500;
+    } else if (intake == PIPELINE_INTAKE_OVERFLOW) {
+      doc["message"] = "Image larger than EEPROM";
+    } else {
+      doc["message"] = "No image uploaded";
+    }
+    extern void sendJson(int code, const JsonDocument& doc);
+    sendJson(code, doc);
+    return;
+  }
+
+  PipelineOptions options;
+  options.boot = g_server->arg("boot") != "0";
+  options.verifyDsp = g_server->arg("verify_dsp") != "0";
+  options.fullErase = g_server->arg("erase") == "full";
+  options.force = g_server->arg("force") == "1";
+
+  g_server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  g_server->send(200, "application/x-ndjson", "");
+
+  PipelineReport report;
+  bool ok = pipeline_run(options, streamPipelinePhase, report);
+  pipeline_end();
+
+  JsonDocument doc;
+  doc["success"] = ok;
+  doc["message"] = ok ? "Pipeline complete" : report.error;
+  doc["imageLength"] = report.imageLength;
+  doc["usedRegion"] = report.usedRegion;
+  doc["pagesChanged"] = report.pagesChanged;
+  doc["pagesErased"] = report.pagesErased;
+  doc["dspReloaded"] = report.dspReloaded;
+  if (options.boot && !dsp_canSelfBoot()) {
+    doc["note"] = "No reset pin configured - the DSP was not reloaded; boot and DSP verify skipped";
+  }
+  doc["uploadMs"] = report.uploadMs;
+  doc["totalMs"] = report.totalMs;
+  JsonObject phases = doc["phases"].to<JsonObject>();
+  for (int p = 0; p < PIPELINE_PHASE_COUNT; p++) {
+    if (report.phases[p].run) {
+      addPipelinePhase(phases[pipeline_phaseName((PipelinePhase)p)].to<JsonObject>(), report.phases[p]);
+    }
+  }
+  String line;
+  serializeJson(doc, line);
+  line += '\n';
+  g_server->sendContent(line);
+}
+
 void register_upload_routes(WebServer &server) {
   // Upload operations
   server.on("/upload_stream", HTTP_POST, handleUploadComplete, handleUploadStream);
+  server.on("/pipeline", HTTP_POST, handlePipelineComplete, handlePipelineUpload);
 }
\ No newline at end of file
@@ -3,14 +3,26 @@
 
 #include <WebServer.h>
 
+// Text upload pipeline, chosen per file from its content
+enum UploadTextFormat {
+  UPLOAD_TEXT_PENDING = 0,  // No significant content seen yet
+  UPLOAD_TEXT_RECORDS,      // Intel HEX / S-record / TI-TXT / C arrays (hex_parser)
+  UPLOAD_TEXT_SIGMA         // SigmaStudio E2Prom.Hex / TxBuffer / NumBytes (sigma_import)
+};
+
 // Upload state (shared across upload handlers)
 extern bool g_is_binary_upload;
 extern uint32_t g_binary_current_addr;
 extern uint32_t g_expected_total_bytes;
+extern UploadTextFormat g_upload_text_format;
+extern bool g_upload_dry_run;
+extern bool g_upload_to_dsp;
 
 // Upload route handlers
 void handleUploadStream();
 void handleUploadComplete();
+void handlePipelineUpload();
+void handlePipelineComplete();
 
 // Upload routes registration
 void register_upload_routes(WebServer &server);
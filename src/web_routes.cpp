@@ -16,11 +16,17 @@ WebServer *g_server = nullptr;
 
 // Helper functions for file type detection (shared with upload module)
 bool isHexFile(const String& filename) {
-  return filename.endsWith(".hex") || filename.endsWith(".txt");
+  String name = filename;
+  name.toLowerCase();
+  return name.endsWith(".hex") || name.endsWith(".txt") ||
+         name.endsWith(".s19") || name.endsWith(".s28") || name.endsWith(".s37") ||
+         name.endsWith(".srec") || name.endsWith(".mot");
 }
 
 bool isBinFile(const String& filename) {
-  return filename.endsWith(".bin") || filename.endsWith(".rom");
+  String name = filename;
+  name.toLowerCase();
+  return name.endsWith(".bin") || name.endsWith(".rom");
 }
 
 void sendJson(int code, const JsonDocument& doc) {
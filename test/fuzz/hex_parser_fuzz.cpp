@@ -0,0 +1,63 @@
+// libFuzzer target for the upload parsers (hex_parser.cpp) on the host.
+//
+//   clang++ -std=gnu++17 -g -O1 -fsanitize=fuzzer,address,undefined \
+//       -Itest/native -Isrc test/fuzz/hex_parser_fuzz.cpp -o hex_parser_fuzz
+//   ./hex_parser_fuzz -max_len=16384 corpus/
+//
+// Without libFuzzer, build with -DHEX_FUZZ_STANDALONE to replay files
+// given on the command line (crash reproduction with gcc).
+//
+// The first input byte seeds the chunk splitter, so the fuzzer also
+// explores record and token boundaries falling across upload chunks.
+#include <Arduino.h>
+#include "hex_sink.h"
+#include "hex_corpus.h"
+#include "hex_parser.cpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  if (size < 1) {
+    return 0;
+  }
+  uint32_t seed = 0x9E3779B9u ^ data[0];
+  const char* text = (const char*)data + 1;
+  size--;
+
+  stubSink_reset();
+  hex_begin();
+  hex_setWriteSink(stubSink_write);
+  size_t pos = 0;
+  while (pos < size) {
+    size_t n = min<size_t>(1 + corpus_rand(seed) % 600, size - pos);
+    processHexChunk(text + pos, n);
+    pos += n;
+  }
+  processHexChunk("", 0);
+  flushBatch();
+
+  if (stubSink.outOfRange || getUploadImageStats().uniqueBytes > EEPROM_SIZE) {
+    abort();
+  }
+  return 0;
+}
+
+#ifdef HEX_FUZZ_STANDALONE
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    FILE* f = fopen(argv[i], "rb");
+    if (!f) {
+      perror(argv[i]);
+      return 1;
+    }
+    std::string input;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+      input.append(buf, n);
+    }
+    fclose(f);
+    LLVMFuzzerTestOneInput((const uint8_t*)input.data(), input.size());
+    printf("%s: ok\n", argv[i]);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,167 @@
+// Host (native env) stand-in for the parts of the Arduino core used by the
+// modules under test. Single-threaded; time is the host clock plus a
+// simulated offset that bus models advance (native_advanceUs).
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT  0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define IRAM_ATTR
+
+// ---- Time ----------------------------------------------------------------
+
+inline uint64_t native_simulatedUs = 0;
+
+inline uint64_t native_nowUs() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (uint64_t)duration_cast<microseconds>(steady_clock::now() - start).count() + native_simulatedUs;
+}
+
+inline void native_advanceUs(uint64_t us) { native_simulatedUs += us; }
+
+inline unsigned long micros() { return (unsigned long)native_nowUs(); }
+inline unsigned long millis() { return (unsigned long)(native_nowUs() / 1000); }
+inline void delay(unsigned long ms) { native_advanceUs((uint64_t)ms * 1000); }
+inline void delayMicroseconds(unsigned int us) { native_advanceUs(us); }
+inline void yield() {}
+
+// ---- GPIO ----------------------------------------------------------------
+
+inline int native_pinLevel[64];
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t pin, uint8_t level) { if (pin < 64) native_pinLevel[pin] = level; }
+inline int digitalRead(uint8_t pin) { return pin < 64 ? native_pinLevel[pin] : LOW; }
+
+// ---- Heap ----------------------------------------------------------------
+
+// Counters maintained by native_heap.h when a test includes it
+struct NativeHeapCounters {
+  uint64_t allocations;
+  uint64_t liveBytes;
+  uint64_t peakBytes;
+};
+inline NativeHeapCounters native_heap = {0, 0, 0};
+#define NATIVE_HEAP_SIZE 320000u   // ESP32-S2 internal RAM, for getFreeHeap()
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+struct NativeEsp {
+  uint32_t getFreeHeap() { return NATIVE_HEAP_SIZE - (uint32_t)min<uint64_t>(native_heap.liveBytes, NATIVE_HEAP_SIZE); }
+  uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+  uint32_t getFreePsram() { return 0; }
+  void restart() {}
+};
+inline NativeEsp ESP;
+
+// ---- Serial --------------------------------------------------------------
+
+// Quiet unless a test sets native_serialEcho (parser logs would swamp output)
+inline bool native_serialEcho = false;
+
+struct NativeSerial {
+  void begin(unsigned long) {}
+  int printf(const char* fmt, ...) {
+    if (!native_serialEcho) return 0;
+    va_list args;
+    va_start(args, fmt);
+    int n = vprintf(fmt, args);
+    va_end(args);
+    return n;
+  }
+  template <class T> void print(const T& v) { if (native_serialEcho) emit(v); }
+  template <class T> void println(const T& v) { if (native_serialEcho) { emit(v); ::printf("\n"); } }
+  void println() { if (native_serialEcho) ::printf("\n"); }
+  int available() { return 0; }
+  int read() { return -1; }
+
+ private:
+  void emit(const char* s) { ::printf("%s", s); }
+  template <class T> void emit(const T& v) { ::printf("%s", std::to_string(v).c_str()); }
+};
+inline NativeSerial Serial;
+
+// ---- String --------------------------------------------------------------
+
+class String {
+ public:
+  String(const char* s = "") : str_(s ? s : "") {}
+  String(const std::string& s) : str_(s) {}
+  String(char c) : str_(1, c) {}
+  String(int v) : str_(std::to_string(v)) {}
+  String(unsigned int v) : str_(std::to_string(v)) {}
+  String(long v) : str_(std::to_string(v)) {}
+  String(unsigned long v) : str_(std::to_string(v)) {}
+  String(double v, int decimals = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    str_ = buf;
+  }
+
+  const char* c_str() const { return str_.c_str(); }
+  unsigned int length() const { return (unsigned int)str_.size(); }
+  bool isEmpty() const { return str_.empty(); }
+  void reserve(unsigned int n) { str_.reserve(n); }
+  long toInt() const { return atol(str_.c_str()); }
+  float toFloat() const { return (float)atof(str_.c_str()); }
+  int indexOf(const char* s, unsigned int from = 0) const { return pos(str_.find(s, from)); }
+  int indexOf(char c, unsigned int from = 0) const { return pos(str_.find(c, from)); }
+  String substring(unsigned int from) const { return String(str_.substr(min<size_t>(from, str_.size()))); }
+  String substring(unsigned int from, unsigned int to) const {
+    from = min<size_t>(from, str_.size());
+    return String(str_.substr(from, to > from ? to - from : 0));
+  }
+  bool startsWith(const String& s) const { return str_.rfind(s.str_, 0) == 0; }
+  bool endsWith(const String& s) const {
+    return str_.size() >= s.str_.size() && str_.compare(str_.size() - s.str_.size(), s.str_.size(), s.str_) == 0;
+  }
+  void toLowerCase() { for (auto& c : str_) c = (char)tolower((unsigned char)c); }
+  void trim() {
+    size_t a = str_.find_first_not_of(" \t\r\n");
+    size_t b = str_.find_last_not_of(" \t\r\n");
+    str_ = (a == std::string::npos) ? std::string() : str_.substr(a, b - a + 1);
+  }
+  char charAt(unsigned int i) const { return i < str_.size() ? str_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+
+  String& operator+=(const String& s) { str_ += s.str_; return *this; }
+  String& operator+=(const char* s) { str_ += s; return *this; }
+  String& operator+=(char c) { str_ += c; return *this; }
+  String& operator+=(int v) { str_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned int v) { str_ += std::to_string(v); return *this; }
+  String& operator+=(long v) { str_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { str_ += std::to_string(v); return *this; }
+  bool operator==(const String& s) const { return str_ == s.str_; }
+  bool operator==(const char* s) const { return str_ == s; }
+  bool operator!=(const String& s) const { return str_ != s.str_; }
+  bool operator!=(const char* s) const { return str_ != s; }
+
+ private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  std::string str_;
+};
+
+template <class T> inline String operator+(String a, const T& b) { a += b; return a; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,99 @@
+// Host stand-in for the ESP32 WiFiServer/WiFiClient pair. A connection is
+// two in-memory byte streams; a test plays the remote peer through
+// native_connect() on the server and the NativeTcpConnection it returns.
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+#include <deque>
+#include <memory>
+
+struct NativeTcpConnection {
+  std::deque<uint8_t> toDevice;       // Sent by the peer, not yet read
+  std::string fromDevice;             // Written by the firmware, not yet taken
+  bool open = true;
+  uint32_t deviceWrites = 0;          // write() calls (TCP_NODELAY: one segment each)
+
+  void send(const uint8_t* data, size_t length) { toDevice.insert(toDevice.end(), data, data + length); }
+  std::string take() {
+    std::string out;
+    out.swap(fromDevice);
+    return out;
+  }
+};
+
+class WiFiClient {
+ public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<NativeTcpConnection> c) : c_(std::move(c)) {}
+
+  explicit operator bool() const { return c_ != nullptr; }
+  uint8_t connected() { return c_ && c_->open; }
+  void stop() {
+    if (c_) c_->open = false;
+    c_.reset();
+  }
+  int setNoDelay(bool) { return 0; }
+
+  int available() { return c_ && c_->open ? (int)c_->toDevice.size() : 0; }
+  int read() {
+    if (!available()) return -1;
+    uint8_t b = c_->toDevice.front();
+    c_->toDevice.pop_front();
+    return b;
+  }
+  int read(uint8_t* buf, size_t size) {
+    size_t n = min<size_t>(size, available());
+    for (size_t i = 0; i < n; i++) {
+      buf[i] = c_->toDevice.front();
+      c_->toDevice.pop_front();
+    }
+    return (int)n;
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    if (!connected()) return 0;
+    c_->fromDevice.append((const char*)data, length);
+    c_->deviceWrites++;
+    return length;
+  }
+  size_t write(uint8_t b) { return write(&b, 1); }
+
+ private:
+  std::shared_ptr<NativeTcpConnection> c_;
+};
+
+class WiFiServer {
+ public:
+  explicit WiFiServer(uint16_t port) : port_(port) {}
+
+  void begin() { listening_ = true; }
+  void end() { listening_ = false; pending_.clear(); }
+  void setNoDelay(bool) {}
+  bool hasClient() { return !pending_.empty(); }
+  WiFiClient available() { return accept(); }
+  WiFiClient accept() {
+    if (pending_.empty()) return WiFiClient();
+    WiFiClient c(pending_.front());
+    pending_.pop_front();
+    return c;
+  }
+
+  // ---- Simulation ----------------------------------------------------------
+
+  // Remote peer connects; null if the server is not listening
+  std::shared_ptr<NativeTcpConnection> native_connect() {
+    if (!listening_) return nullptr;
+    auto c = std::make_shared<NativeTcpConnection>();
+    pending_.push_back(c);
+    return c;
+  }
+  uint16_t native_port() const { return port_; }
+
+ private:
+  uint16_t port_;
+  bool listening_ = false;
+  std::deque<std::shared_ptr<NativeTcpConnection>> pending_;
+};
+
+#endif // NATIVE_WIFI_H
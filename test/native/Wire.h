@@ -0,0 +1,200 @@
+// Host stand-in for the ESP32 TwoWire driver. Master transfers go to
+// simulated devices attached by address and advance the simulated clock
+// by their bit time at the bus clock, so benchmarks report wire time.
+// Slave mode keeps the driver's TX queue and lets a test play the master
+// (native_masterWrite / native_masterRead). As in the S2 core, every
+// slaveWrite resets the queue before queueing and onRequest runs on every
+// read request.
+#ifndef NATIVE_WIRE_H
+#define NATIVE_WIRE_H
+
+#include <Arduino.h>
+#include <deque>
+
+#define I2C_BUFFER_LENGTH 128
+
+// A device on the simulated bus: one call per transaction phase
+class NativeI2CDevice {
+ public:
+  virtual ~NativeI2CDevice() {}
+  virtual bool ack() { return true; }                                // Address phase
+  virtual void receive(const uint8_t* data, size_t length) = 0;       // Master write
+  virtual size_t transmit(uint8_t* data, size_t length) = 0;          // Master read
+};
+
+struct NativeWireStats {
+  uint32_t transactions;
+  uint32_t bytes;           // Payload bytes, excluding address bytes
+  uint32_t nacks;
+  uint64_t busUs;           // Simulated time on the wire
+};
+
+class TwoWire {
+ public:
+  typedef void (*ReceiveCb)(int);
+  typedef void (*RequestCb)();
+
+  explicit TwoWire(uint8_t num) : num_(num) {}
+
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+    (void)sda; (void)scl;
+    active_ = true;
+    slave_ = false;
+    if (frequency) clockHz_ = frequency;
+    return true;
+  }
+  bool begin(uint8_t slaveAddr, int sda, int scl, uint32_t frequency) {
+    (void)sda; (void)scl; (void)frequency;
+    active_ = true;
+    slave_ = true;
+    slaveAddr_ = slaveAddr;
+    slaveTx_.clear();
+    return true;
+  }
+  bool end() {
+    active_ = false;
+    slaveTx_.clear();
+    return true;
+  }
+  bool setClock(uint32_t hz) { clockHz_ = hz; return true; }
+  uint32_t getClock() { return clockHz_; }
+  void setTimeOut(uint16_t) {}
+  size_t setBufferSize(size_t size) { bufferSize_ = size; return size; }
+
+  void beginTransmission(uint16_t address) {
+    txAddress_ = (uint8_t)address;
+    txLength_ = 0;
+    txOverflow_ = false;
+  }
+  size_t write(uint8_t value) {
+    if (txLength_ >= min<size_t>(bufferSize_, sizeof(txBuffer_))) {
+      txOverflow_ = true;
+      return 0;
+    }
+    txBuffer_[txLength_++] = value;
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t length) {
+    size_t n = 0;
+    while (n < length && write(data[n])) n++;
+    return n;
+  }
+
+  // 0 ok, 1 data too long, 2 address NACK, 4 bus not started
+  uint8_t endTransmission(bool sendStop = true) {
+    (void)sendStop;
+    if (!active_ || slave_) return 4;
+    if (txOverflow_) return 1;
+    NativeI2CDevice* dev = device(txAddress_);
+    account(txLength_);
+    if (!dev || !dev->ack()) {
+      stats.nacks++;
+      return 2;
+    }
+    dev->receive(txBuffer_, txLength_);
+    return 0;
+  }
+
+  uint8_t requestFrom(uint16_t address, size_t length, bool sendStop = true) {
+    (void)sendStop;
+    rxLength_ = rxIndex_ = 0;
+    if (!active_ || slave_) return 0;
+    length = min<size_t>(length, min<size_t>(bufferSize_, sizeof(rxBuffer_)));
+    NativeI2CDevice* dev = device((uint8_t)address);
+    account(length);
+    if (!dev || !dev->ack()) {
+      stats.nacks++;
+      return 0;
+    }
+    rxLength_ = dev->transmit(rxBuffer_, length);
+    return (uint8_t)rxLength_;
+  }
+  uint8_t requestFrom(uint8_t address, uint8_t length) { return requestFrom((uint16_t)address, (size_t)length, true); }
+  uint8_t requestFrom(int address, int length) { return requestFrom((uint16_t)address, (size_t)length, true); }
+
+  int available() { return (int)(rxLength_ - rxIndex_); }
+  int read() { return rxIndex_ < rxLength_ ? rxBuffer_[rxIndex_++] : -1; }
+  int peek() { return rxIndex_ < rxLength_ ? rxBuffer_[rxIndex_] : -1; }
+
+  // Slave mode
+  void onReceive(ReceiveCb cb) { onReceive_ = cb; }
+  void onRequest(RequestCb cb) { onRequest_ = cb; }
+  size_t slaveWrite(const uint8_t* data, size_t length) {
+    slaveTx_.clear();
+    size_t n = 0;
+    while (n < length && slaveTx_.size() < bufferSize_) {
+      slaveTx_.push_back(data[n++]);
+    }
+    return n;
+  }
+
+  // ---- Simulation ----------------------------------------------------------
+
+  void native_attach(uint8_t address, NativeI2CDevice* dev) { devices_[address & 0x7F] = dev; }
+  void native_detachAll() { memset(devices_, 0, sizeof(devices_)); }
+
+  // Master side of a slave-mode transaction: the driver hands written
+  // bytes to onReceive; reads call onRequest, then drain the TX queue.
+  // Unqueued bytes read as 0xFF, as on a real bus.
+  void native_masterWrite(const uint8_t* data, size_t length) {
+    rxLength_ = min<size_t>(length, sizeof(rxBuffer_));
+    rxIndex_ = 0;
+    memcpy(rxBuffer_, data, rxLength_);
+    account(length);
+    if (onReceive_) onReceive_((int)rxLength_);
+  }
+  size_t native_masterRead(uint8_t* out, size_t length) {
+    if (onRequest_) onRequest_();
+    account(length);
+    for (size_t i = 0; i < length; i++) {
+      if (slaveTx_.empty()) {
+        out[i] = 0xFF;
+        continue;
+      }
+      out[i] = slaveTx_.front();
+      slaveTx_.pop_front();
+    }
+    return length;
+  }
+  size_t native_slaveQueued() const { return slaveTx_.size(); }
+
+  NativeWireStats stats = {};
+
+ private:
+  NativeI2CDevice* device(uint8_t address) { return devices_[address & 0x7F]; }
+
+  // Start, address byte, data bytes (8 bits + ACK each), stop
+  void account(size_t dataBytes) {
+    uint64_t bits = 2 + 9 * (uint64_t)(dataBytes + 1);
+    uint64_t us = (bits * 1000000ULL + clockHz_ - 1) / clockHz_;
+    stats.transactions++;
+    stats.bytes += (uint32_t)dataBytes;
+    stats.busUs += us;
+    native_advanceUs(us);
+  }
+
+  uint8_t num_;
+  bool active_ = false;
+  bool slave_ = false;
+  uint8_t slaveAddr_ = 0;
+  uint32_t clockHz_ = 100000;
+  size_t bufferSize_ = I2C_BUFFER_LENGTH;
+  NativeI2CDevice* devices_[128] = {};
+
+  uint8_t txAddress_ = 0;
+  uint8_t txBuffer_[I2C_BUFFER_LENGTH];
+  size_t txLength_ = 0;
+  bool txOverflow_ = false;
+  uint8_t rxBuffer_[I2C_BUFFER_LENGTH];
+  size_t rxLength_ = 0;
+  size_t rxIndex_ = 0;
+
+  std::deque<uint8_t> slaveTx_;
+  ReceiveCb onReceive_ = nullptr;
+  RequestCb onRequest_ = nullptr;
+};
+
+inline TwoWire Wire(0);
+inline TwoWire Wire1(1);
+
+#endif // NATIVE_WIRE_H
@@ -0,0 +1,152 @@
+// Simulated ADAU1701 for host tests and benchmarks: parameter RAM, program
+// RAM and the control registers behind a 2-byte subaddress with word-wise
+// auto-increment, plus safeload transfers applied one audio frame after
+// IST is set. Attach to a native TwoWire (see Wire.h).
+#ifndef ADAU1701_MODEL_H
+#define ADAU1701_MODEL_H
+
+#include <Wire.h>
+#include "dsp_helper.h"
+
+class Adau1701Model : public NativeI2CDevice {
+ public:
+  static const uint32_t kFrameUs = 21;           // One sample period at 48 kHz
+
+  uint8_t param[ADAU1701_PARAM_RAM_WORDS * ADAU1701_PARAM_WORD_BYTES];
+  uint8_t program[ADAU1701_PROG_RAM_WORDS * ADAU1701_PROG_WORD_BYTES];
+  uint8_t regs[ADAU1701_HW_REG_END - ADAU1701_HW_REG_START + 1][5];
+  uint8_t legacy[0x100];                         // 0xF000 byte-wide register block
+  bool present = true;
+
+  uint32_t writes = 0;                           // Write transactions
+  uint32_t reads = 0;                            // Read transactions
+  uint32_t safeloads = 0;                        // IST transfers applied
+
+  Adau1701Model() { reset(); }
+
+  void reset() {
+    memset(param, 0, sizeof(param));
+    memset(program, 0, sizeof(program));
+    memset(regs, 0, sizeof(regs));
+    memset(legacy, 0, sizeof(legacy));
+    legacy[1] = ADAU1701_SR_DCK_STABLE | ADAU1701_SR_PLL_LOCKED | ADAU1701_SR_SAFELOAD_RDY;
+    legacy[2] = 0x02;                            // Hardware ID
+    pointer_ = 0;
+    istPending_ = false;
+    slotsLoaded_ = 0;
+    writes = reads = safeloads = 0;
+  }
+
+  // Data bytes per register (datasheet Table 29 widths)
+  static size_t registerBytes(uint16_t subaddress) {
+    if (subaddress < 0x0808) return 4;           // Interface registers
+    if (subaddress < 0x0810) return 2;           // GPIO, aux ADC
+    if (subaddress < 0x0815) return 5;           // Safeload data
+    if (subaddress == 0x081D || subaddress == 0x081F) return 1;
+    if (subaddress == 0x0820 || subaddress == 0x0821) return 3;
+    return 2;
+  }
+
+  static size_t wordBytes(uint16_t subaddress) {
+    if (subaddress < ADAU1701_PROG_RAM_START) return ADAU1701_PARAM_WORD_BYTES;
+    if (subaddress < ADAU1701_HW_REG_START) return ADAU1701_PROG_WORD_BYTES;
+    if (subaddress <= ADAU1701_HW_REG_END) return registerBytes(subaddress);
+    return 1;
+  }
+
+  uint32_t paramWord(uint16_t address) const {
+    const uint8_t* w = &param[(address % ADAU1701_PARAM_RAM_WORDS) * ADAU1701_PARAM_WORD_BYTES];
+    return ((uint32_t)w[0] << 24) | ((uint32_t)w[1] << 16) | ((uint32_t)w[2] << 8) | w[3];
+  }
+
+  uint16_t coreControl() {
+    serviceSafeload();
+    uint8_t* r = reg(ADAU1701_CORE_CONTROL_REG);
+    return ((uint16_t)r[0] << 8) | r[1];
+  }
+
+  bool ack() override { return present; }
+
+  void receive(const uint8_t* data, size_t length) override {
+    if (length < 2) return;
+    serviceSafeload();
+    pointer_ = ((uint16_t)data[0] << 8) | data[1];
+    if (length == 2) return;                     // Subaddress for a following read
+    writes++;
+
+    uint16_t sub = pointer_;
+    size_t offset = 0;
+    for (size_t i = 2; i < length; i++) {
+      byteAt(sub, offset) = data[i];
+      if (++offset == wordBytes(sub)) {
+        onWordWritten(sub);
+        sub++;
+        offset = 0;
+      }
+    }
+  }
+
+  size_t transmit(uint8_t* data, size_t length) override {
+    serviceSafeload();
+    reads++;
+    uint16_t sub = pointer_;
+    size_t offset = 0;
+    for (size_t i = 0; i < length; i++) {
+      data[i] = byteAt(sub, offset);
+      if (++offset == wordBytes(sub)) {
+        sub++;
+        offset = 0;
+      }
+    }
+    return length;
+  }
+
+ private:
+  uint8_t* reg(uint16_t subaddress) { return regs[subaddress - ADAU1701_HW_REG_START]; }
+
+  uint8_t& byteAt(uint16_t sub, size_t offset) {
+    static uint8_t sink;
+    if (sub < ADAU1701_PROG_RAM_START) return param[sub * ADAU1701_PARAM_WORD_BYTES + offset];
+    if (sub < ADAU1701_HW_REG_START) {
+      return program[(sub - ADAU1701_PROG_RAM_START) % ADAU1701_PROG_RAM_WORDS * ADAU1701_PROG_WORD_BYTES + offset];
+    }
+    if (sub <= ADAU1701_HW_REG_END) return reg(sub)[offset];
+    if ((sub & 0xFF00) == 0xF000) return legacy[sub & 0xFF];
+    sink = 0;
+    return sink;
+  }
+
+  void onWordWritten(uint16_t sub) {
+    if (sub >= ADAU1701_SAFELOAD_ADDR_REG && sub < ADAU1701_SAFELOAD_ADDR_REG + ADAU1701_SAFELOAD_SLOTS) {
+      slotsLoaded_ |= 1 << (sub - ADAU1701_SAFELOAD_ADDR_REG);
+    }
+    if (sub == ADAU1701_CORE_CONTROL_REG && (reg(sub)[1] & ADAU1701_CORE_CONTROL_IST)) {
+      istPending_ = true;
+      istAtUs_ = native_nowUs() + kFrameUs;
+    }
+  }
+
+  // Slots loaded since the last transfer move into parameter RAM at the
+  // next frame boundary, then IST reads back clear
+  void serviceSafeload() {
+    if (!istPending_ || native_nowUs() < istAtUs_) return;
+    for (uint16_t slot = 0; slot < ADAU1701_SAFELOAD_SLOTS; slot++) {
+      if (!(slotsLoaded_ & (1 << slot))) continue;
+      const uint8_t* a = reg(ADAU1701_SAFELOAD_ADDR_REG + slot);
+      uint16_t target = (((uint16_t)a[0] << 8) | a[1]) % ADAU1701_PARAM_RAM_WORDS;
+      memcpy(&param[target * ADAU1701_PARAM_WORD_BYTES], reg(ADAU1701_SAFELOAD_DATA_REG + slot) + 1,
+             ADAU1701_PARAM_WORD_BYTES);
+    }
+    reg(ADAU1701_CORE_CONTROL_REG)[1] &= ~ADAU1701_CORE_CONTROL_IST;
+    istPending_ = false;
+    slotsLoaded_ = 0;
+    safeloads++;
+  }
+
+  uint16_t pointer_ = 0;
+  bool istPending_ = false;
+  uint8_t slotsLoaded_ = 0;
+  uint64_t istAtUs_ = 0;
+};
+
+#endif // ADAU1701_MODEL_H
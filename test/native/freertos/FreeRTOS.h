@@ -0,0 +1,28 @@
+// Single-threaded host stand-in for the FreeRTOS API used by the modules
+// under test. Semaphores never block (one thread cannot contend), task
+// bodies run only when a test calls native_runTasks(), and delays advance
+// the simulated clock.
+#ifndef NATIVE_FREERTOS_H
+#define NATIVE_FREERTOS_H
+
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+struct portMUX_TYPE { int owner; };
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux)  ((void)(mux))
+
+#endif // NATIVE_FREERTOS_H
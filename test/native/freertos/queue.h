@@ -0,0 +1,35 @@
+#ifndef NATIVE_FREERTOS_QUEUE_H
+#define NATIVE_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+struct NativeQueue {
+  size_t itemSize;
+  size_t length;
+  std::deque<std::vector<uint8_t>> items;
+};
+typedef NativeQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  return new NativeQueue{ itemSize, length, {} };
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t) {
+  if (q->items.size() >= q->length) return pdFALSE;
+  const uint8_t* p = (const uint8_t*)item;
+  q->items.emplace_back(p, p + q->itemSize);
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t wait) {
+  if (q->items.empty()) {
+    if (wait == portMAX_DELAY && native_currentTask) throw NativeTaskIdle();
+    return pdFALSE;
+  }
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  return pdTRUE;
+}
+
+#endif // NATIVE_FREERTOS_QUEUE_H
@@ -0,0 +1,55 @@
+#ifndef NATIVE_FREERTOS_TASK_H
+#define NATIVE_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+struct NativeTask {
+  TaskFunction_t fn;
+  void* param;
+  bool deleted;
+};
+typedef NativeTask* TaskHandle_t;
+
+// Thrown by a blocking receive on an empty queue: the task has nothing
+// left to do until the test queues more work
+struct NativeTaskIdle {};
+
+inline std::deque<NativeTask> native_tasks;
+inline NativeTask* native_currentTask = nullptr;
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char*, uint32_t, void* param,
+                              UBaseType_t, TaskHandle_t* handle) {
+  native_tasks.push_back({ fn, param, false });
+  if (handle) *handle = &native_tasks.back();
+  return pdPASS;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                                          UBaseType_t prio, TaskHandle_t* handle, BaseType_t) {
+  return xTaskCreate(fn, name, stack, param, prio, handle);
+}
+
+inline void vTaskDelete(TaskHandle_t task) {
+  NativeTask* t = task ? task : native_currentTask;
+  if (t) t->deleted = true;
+  if (t && t == native_currentTask) throw NativeTaskIdle();
+}
+
+inline void vTaskDelay(TickType_t ticks) { native_advanceUs((uint64_t)ticks * 1000); }
+
+// Run every live task until it blocks on an empty queue or deletes itself
+inline void native_runTasks() {
+  for (NativeTask& t : native_tasks) {
+    if (t.deleted) continue;
+    native_currentTask = &t;
+    try {
+      t.fn(t.param);
+    } catch (const NativeTaskIdle&) {
+    }
+    native_currentTask = nullptr;
+  }
+}
+
+#endif // NATIVE_FREERTOS_TASK_H
@@ -0,0 +1,127 @@
+// Upload corpus for the hex_parser tests, benchmark and fuzz target.
+//
+// The image has the shape of a SigmaStudio E2Prom export for the ADAU1701:
+// self-boot write messages for program RAM, parameter RAM and the core
+// control register, then an END message. It is rendered the ways
+// SigmaStudio and common toolchains export it: E2Prom.Hex C array
+// (CRLF, "0x01 , " tokens), Intel HEX, S-record and TI-TXT.
+#ifndef HEX_CORPUS_H
+#define HEX_CORPUS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+struct CorpusFile {
+  const char* name;
+  std::string text;
+};
+
+inline uint32_t corpus_rand(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+inline void corpus_writeMessage(std::vector<uint8_t>& img, uint16_t subaddress,
+                                size_t dataBytes, uint32_t& seed) {
+  uint16_t msgLen = (uint16_t)(dataBytes + 3);  // Device address + subaddress + data
+  img.push_back(0x01);
+  img.push_back(msgLen >> 8);
+  img.push_back(msgLen & 0xFF);
+  img.push_back(0x00);
+  img.push_back(subaddress >> 8);
+  img.push_back(subaddress & 0xFF);
+  for (size_t i = 0; i < dataBytes; i++) {
+    img.push_back((uint8_t)corpus_rand(seed));
+  }
+}
+
+// Full-size project: 1024 program words, 1024 parameter words
+inline std::vector<uint8_t> corpus_selfBootImage() {
+  std::vector<uint8_t> img;
+  uint32_t seed = 0x1701u;
+  corpus_writeMessage(img, 0x081C, 2, seed);        // Core control: stop
+  corpus_writeMessage(img, 0x0400, 1024 * 5, seed); // Program RAM
+  corpus_writeMessage(img, 0x0000, 1024 * 4, seed); // Parameter RAM
+  corpus_writeMessage(img, 0x081C, 2, seed);        // Core control: run
+  img.push_back(0x00);                              // END
+  return img;
+}
+
+inline std::string corpus_cArray(const std::vector<uint8_t>& img) {
+  std::string out;
+  char tok[8];
+  for (size_t i = 0; i < img.size(); i++) {
+    snprintf(tok, sizeof(tok), "0x%02X , ", img[i]);
+    out += tok;
+    if (i % 8 == 7) out += "\r\n";
+  }
+  out += "\r\n";
+  return out;
+}
+
+inline std::string corpus_intelHex(const std::vector<uint8_t>& img) {
+  std::string out;
+  char buf[64];
+  for (size_t addr = 0; addr < img.size(); addr += 16) {
+    size_t n = std::min<size_t>(16, img.size() - addr);
+    uint8_t sum = (uint8_t)(n + (addr >> 8) + (addr & 0xFF));
+    snprintf(buf, sizeof(buf), ":%02X%04X00", (unsigned)n, (unsigned)addr);
+    out += buf;
+    for (size_t i = 0; i < n; i++) {
+      snprintf(buf, sizeof(buf), "%02X", img[addr + i]);
+      out += buf;
+      sum += img[addr + i];
+    }
+    snprintf(buf, sizeof(buf), "%02X\r\n", (uint8_t)(0x100 - sum));
+    out += buf;
+  }
+  out += ":00000001FF\r\n";
+  return out;
+}
+
+inline std::string corpus_sRecord(const std::vector<uint8_t>& img) {
+  std::string out = "S00600004844521B\n";
+  char buf[64];
+  for (size_t addr = 0; addr < img.size(); addr += 32) {
+    size_t n = std::min<size_t>(32, img.size() - addr);
+    uint8_t count = (uint8_t)(n + 3);
+    uint8_t sum = count + (addr >> 8) + (addr & 0xFF);
+    snprintf(buf, sizeof(buf), "S1%02X%04X", count, (unsigned)addr);
+    out += buf;
+    for (size_t i = 0; i < n; i++) {
+      snprintf(buf, sizeof(buf), "%02X", img[addr + i]);
+      out += buf;
+      sum += img[addr + i];
+    }
+    snprintf(buf, sizeof(buf), "%02X\n", (uint8_t)~sum);
+    out += buf;
+  }
+  out += "S9030000FC\n";
+  return out;
+}
+
+inline std::string corpus_tiTxt(const std::vector<uint8_t>& img) {
+  std::string out = "@0000\n";
+  char buf[8];
+  for (size_t i = 0; i < img.size(); i++) {
+    snprintf(buf, sizeof(buf), i % 16 == 15 ? "%02X\n" : "%02X ", img[i]);
+    out += buf;
+  }
+  out += "\nq\n";
+  return out;
+}
+
+inline std::vector<CorpusFile> corpus_files(const std::vector<uint8_t>& img) {
+  return {
+    { "E2Prom.Hex (C array)", corpus_cArray(img) },
+    { "Intel HEX", corpus_intelHex(img) },
+    { "S-record", corpus_sRecord(img) },
+    { "TI-TXT", corpus_tiTxt(img) },
+  };
+}
+
+#endif // HEX_CORPUS_H
@@ -0,0 +1,46 @@
+// Counting replacements for global new/delete, so native tests can report
+// allocations and peak heap of the code under test. Replacement operators
+// cannot be inline: include this from exactly one translation unit.
+#ifndef NATIVE_HEAP_H
+#define NATIVE_HEAP_H
+
+#include <Arduino.h>
+#include <new>
+
+static void* nativeHeapAlloc(size_t size) {
+  // Size header so delete can keep liveBytes exact
+  size_t* p = (size_t*)malloc(size + sizeof(size_t) * 2);
+  if (!p) throw std::bad_alloc();
+  p[0] = size;
+  native_heap.allocations++;
+  native_heap.liveBytes += size;
+  native_heap.peakBytes = max(native_heap.peakBytes, native_heap.liveBytes);
+  return p + 2;
+}
+
+static void nativeHeapFree(void* ptr) {
+  if (!ptr) return;
+  size_t* p = (size_t*)ptr - 2;
+  native_heap.liveBytes -= p[0];
+  free(p);
+}
+
+void* operator new(size_t size) { return nativeHeapAlloc(size); }
+void* operator new[](size_t size) { return nativeHeapAlloc(size); }
+void operator delete(void* ptr) noexcept { nativeHeapFree(ptr); }
+void operator delete[](void* ptr) noexcept { nativeHeapFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { nativeHeapFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { nativeHeapFree(ptr); }
+
+// Counters relative to a starting point
+struct NativeHeapMark {
+  uint64_t allocations;
+  uint64_t liveBytes;
+};
+
+inline NativeHeapMark native_heapMark() {
+  native_heap.peakBytes = native_heap.liveBytes;
+  return { native_heap.allocations, native_heap.liveBytes };
+}
+
+#endif // NATIVE_HEAP_H
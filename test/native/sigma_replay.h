@@ -0,0 +1,158 @@
+// Stand-in SigmaStudio client: replays a recorded SigmaTCP transcript
+// against the firmware's server through the WiFi.h shim and checks every
+// reply byte.
+//
+// Transcript lines:
+//   # text        comment
+//   ! connect     new connection (SigmaStudio link start)
+//   > hex bytes   one TCP segment from SigmaStudio
+//   < hex bytes   bytes the server must have sent since the last check
+//   + hex bytes   continues the previous > or < line
+#ifndef SIGMA_REPLAY_H
+#define SIGMA_REPLAY_H
+
+#include <WiFi.h>
+#include <vector>
+
+struct SigmaReplayResult {
+  bool ok;
+  int line;                 // Transcript line of the failure
+  std::string message;
+  uint32_t connections;
+  uint32_t segments;
+  uint32_t bytesSent;
+  uint32_t bytesReceived;
+};
+
+struct SigmaReplayStep {
+  char kind;                // '!', '>' or '<'
+  int line;
+  std::vector<uint8_t> bytes;
+};
+
+static bool sigma_replayParseHex(const std::string& text, std::vector<uint8_t>& out) {
+  size_t i = 0;
+  while (i < text.size()) {
+    if (isspace((unsigned char)text[i])) {
+      i++;
+      continue;
+    }
+    if (i + 1 >= text.size() || !isxdigit((unsigned char)text[i]) || !isxdigit((unsigned char)text[i + 1])) {
+      return false;
+    }
+    out.push_back((uint8_t)strtoul(text.substr(i, 2).c_str(), nullptr, 16));
+    i += 2;
+  }
+  return true;
+}
+
+static bool sigma_replayParse(const char* transcript, std::vector<SigmaReplayStep>& steps, SigmaReplayResult& r) {
+  int lineNo = 0;
+  const char* p = transcript;
+  while (*p) {
+    const char* end = strchr(p, '\n');
+    std::string line = end ? std::string(p, end - p) : std::string(p);
+    p = end ? end + 1 : p + line.size();
+    lineNo++;
+    if (line.empty() || line[0] == '#') continue;
+
+    char kind = line[0];
+    std::string rest = line.substr(1);
+    if (kind == '!') {
+      if (rest.find("connect") == std::string::npos) {
+        r = { false, lineNo, "unknown directive", 0, 0, 0, 0 };
+        return false;
+      }
+      steps.push_back({ '!', lineNo, {} });
+      continue;
+    }
+    if (kind != '>' && kind != '<' && kind != '+') {
+      r = { false, lineNo, "unknown line type", 0, 0, 0, 0 };
+      return false;
+    }
+    if (kind == '+') {
+      if (steps.empty() || steps.back().kind == '!') {
+        r = { false, lineNo, "continuation without a segment", 0, 0, 0, 0 };
+        return false;
+      }
+    } else {
+      steps.push_back({ kind, lineNo, {} });
+    }
+    if (!sigma_replayParseHex(rest, steps.back().bytes)) {
+      r = { false, lineNo, "bad hex", 0, 0, 0, 0 };
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::string sigma_replayHex(const std::string& bytes, size_t from, size_t count) {
+  std::string s;
+  char b[4];
+  for (size_t i = from; i < bytes.size() && i < from + count; i++) {
+    snprintf(b, sizeof(b), "%02X ", (uint8_t)bytes[i]);
+    s += b;
+  }
+  return s;
+}
+
+// Run a transcript. service() is the firmware's poll function; it is
+// called until each segment is consumed, as loop() would.
+inline SigmaReplayResult sigma_replay(WiFiServer& server, const char* transcript, void (*service)()) {
+  SigmaReplayResult r = { true, 0, "", 0, 0, 0, 0 };
+  std::vector<SigmaReplayStep> steps;
+  if (!sigma_replayParse(transcript, steps, r)) {
+    return r;
+  }
+
+  std::shared_ptr<NativeTcpConnection> conn;
+  auto fail = [&](int line, const std::string& message) {
+    r.ok = false;
+    r.line = line;
+    r.message = message;
+    return r;
+  };
+
+  for (const SigmaReplayStep& step : steps) {
+    if (step.kind == '!') {
+      if (conn && !conn->fromDevice.empty()) return fail(step.line, "unexpected reply bytes");
+      std::shared_ptr<NativeTcpConnection> previous = conn;
+      conn = server.native_connect();
+      if (!conn) return fail(step.line, "server not listening");
+      service();
+      if (previous && previous->open) return fail(step.line, "previous connection still open");
+      r.connections++;
+      continue;
+    }
+    if (!conn) return fail(step.line, "no connection");
+
+    if (step.kind == '>') {
+      conn->send(step.bytes.data(), step.bytes.size());
+      for (int polls = 0; !conn->toDevice.empty(); polls++) {
+        if (polls == 1000 || !conn->open) return fail(step.line, "segment not consumed");
+        service();
+      }
+      r.segments++;
+      r.bytesSent += step.bytes.size();
+      continue;
+    }
+
+    std::string got = conn->take();
+    r.bytesReceived += got.size();
+    std::string want(step.bytes.begin(), step.bytes.end());
+    if (got != want) {
+      size_t at = 0;
+      while (at < got.size() && at < want.size() && got[at] == want[at]) at++;
+      return fail(step.line, "reply differs at byte " + std::to_string(at) + ": got " +
+                  sigma_replayHex(got, at, 8) + "want " + sigma_replayHex(want, at, 8) + "(" +
+                  std::to_string(got.size()) + " vs " + std::to_string(want.size()) + " bytes)");
+    }
+  }
+
+  if (conn && !conn->fromDevice.empty()) {
+    return fail(steps.empty() ? 0 : steps.back().line, "unexpected trailing reply bytes");
+  }
+  return r;
+}
+
+#endif // SIGMA_REPLAY_H
@@ -0,0 +1,263 @@
+// dsp_helper burst transfers against a simulated ADAU1701: correctness of
+// the block and word calls, and a bus-time benchmark of bursts against
+// one transaction per word / per register.
+//
+//   pio test -e native -f test_dsp_burst -v
+#include <Arduino.h>
+#include <unity.h>
+#include "adau1701_model.h"
+#include "eeprom_emulator.h"
+#include "i2c_bus.cpp"
+#include "dsp_helper.cpp"
+
+static Adau1701Model dsp;
+
+// Link-time dependencies of i2c_bus.cpp and dsp_helper.cpp
+const EepromEmuStats& eeprom_emu_getStats() {
+  static EepromEmuStats stats = {};
+  return stats;
+}
+void setWriteProtect(bool) {}
+
+static void useClock(uint32_t hz) {
+  i2c_busBegin(0, SDA_PIN, SCL_PIN, hz);
+}
+
+// Wire statistics since the last call
+static NativeWireStats busDelta() {
+  static NativeWireStats last = {};
+  NativeWireStats now = Wire.stats;
+  NativeWireStats d = { now.transactions - last.transactions, now.bytes - last.bytes,
+                        now.nacks - last.nacks, now.busUs - last.busUs };
+  last = now;
+  return d;
+}
+
+static void fillPattern(uint8_t* data, size_t length, uint32_t seed) {
+  for (size_t i = 0; i < length; i++) {
+    seed = seed * 1103515245u + 12345u;
+    data[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+void setUp() {
+  dsp.reset();
+  Wire.native_detachAll();
+  Wire.native_attach(DSP_I2C_ADDRESS, &dsp);
+  useClock(I2C_CLOCK_HZ);
+  busDelta();
+}
+
+void tearDown() {}
+
+static void test_block_round_trip() {
+  uint8_t prog[ADAU1701_PROG_RAM_WORDS * ADAU1701_PROG_WORD_BYTES];
+  uint8_t back[sizeof(prog)];
+  fillPattern(prog, sizeof(prog), 1);
+  TEST_ASSERT_TRUE(dsp_writeProgramWords(ADAU1701_PROG_RAM_START, prog, ADAU1701_PROG_RAM_WORDS));
+  TEST_ASSERT_EQUAL_MEMORY(prog, dsp.program, sizeof(prog));
+  TEST_ASSERT_TRUE(dsp_readProgramWords(ADAU1701_PROG_RAM_START, back, ADAU1701_PROG_RAM_WORDS));
+  TEST_ASSERT_EQUAL_MEMORY(prog, back, sizeof(prog));
+
+  int32_t words[ADAU1701_PARAM_RAM_WORDS];
+  int32_t wordsBack[ADAU1701_PARAM_RAM_WORDS];
+  for (int i = 0; i < ADAU1701_PARAM_RAM_WORDS; i++) {
+    words[i] = (int32_t)(i * 0x01010101u) - 0x08000000;
+  }
+  TEST_ASSERT_TRUE(dsp_writeParamWords(0, words, ADAU1701_PARAM_RAM_WORDS));
+  TEST_ASSERT_TRUE(dsp_readParamWords(0, wordsBack, ADAU1701_PARAM_RAM_WORDS));
+  TEST_ASSERT_EQUAL_MEMORY(words, wordsBack, sizeof(words));
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)words[1023], dsp.paramWord(1023));
+  TEST_ASSERT_EQUAL(ADAU1701_PARAM_RAM_WORDS, dsp_shadowValidCount());
+}
+
+// Bursts never split a word and never exceed the Wire buffer
+static void test_burst_alignment() {
+  uint8_t data[ADAU1701_PROG_WORD_BYTES * 100];
+  fillPattern(data, sizeof(data), 7);
+  TEST_ASSERT_TRUE(dsp_writeBlock(ADAU1701_PROG_RAM_START + 3, data, sizeof(data)));
+  TEST_ASSERT_EQUAL_MEMORY(data, dsp.program + 3 * ADAU1701_PROG_WORD_BYTES, sizeof(data));
+  TEST_ASSERT_EQUAL((sizeof(data) + DSP_BURST_MAX_DATA - 1) / DSP_BURST_MAX_DATA, dsp.writes);
+
+  TEST_ASSERT_FALSE(dsp_writeBlock(ADAU1701_PROG_RAM_START, data, 7));   // Partial word
+  TEST_ASSERT_FALSE(dsp_writeBlock(0, data, 6));
+}
+
+static void test_safeload_applies_every_word() {
+  DSPParamWrite params[23];
+  for (int i = 0; i < 23; i++) {
+    params[i] = { (uint16_t)(100 + i * 7), dsp_floatTo523(0.01f * i) };
+  }
+  TEST_ASSERT_TRUE(dsp_safeloadParams(params, 23));
+  native_advanceUs(Adau1701Model::kFrameUs);
+  TEST_ASSERT_EQUAL(0, dsp.coreControl() & ADAU1701_CORE_CONTROL_IST);   // Last transfer landed
+  for (int i = 0; i < 23; i++) {
+    TEST_ASSERT_EQUAL_HEX32((uint32_t)params[i].value, dsp.paramWord(params[i].address));
+  }
+  TEST_ASSERT_EQUAL(5, dsp.safeloads);            // ceil(23 / 5)
+}
+
+static void test_float_to_523_saturates() {
+  TEST_ASSERT_EQUAL_HEX32(0x00800000, dsp_floatTo523(1.0f));
+  TEST_ASSERT_EQUAL_HEX32(0xFF800000, (uint32_t)dsp_floatTo523(-1.0f));
+  TEST_ASSERT_EQUAL_HEX32(0x07FFFFFF, dsp_floatTo523(16.0f));
+  TEST_ASSERT_EQUAL_HEX32(0x07FFFFFF, dsp_floatTo523(15.9999999f));
+  TEST_ASSERT_EQUAL_HEX32(0x07FFFFFF, dsp_floatTo523(1e9f));
+  TEST_ASSERT_EQUAL_HEX32(0xF8000000, (uint32_t)dsp_floatTo523(-16.0f));
+  TEST_ASSERT_EQUAL_HEX32(0xF8000000, (uint32_t)dsp_floatTo523(-1e9f));
+  TEST_ASSERT_EQUAL(0, dsp_floatTo523(NAN));
+}
+
+// A slot left staged through the legacy API must not displace batch words
+static void test_safeload_ignores_stale_staging() {
+  uint8_t stale[4] = {0x01, 0x02, 0x03, 0x04};
+  TEST_ASSERT_TRUE(dsp_safeloadWrite(900, stale, sizeof(stale)));
+  DSPParamWrite params[5];
+  for (int i = 0; i < 5; i++) {
+    params[i] = { (uint16_t)(10 + i), dsp_floatTo523(0.25f * (i + 1)) };
+  }
+  TEST_ASSERT_TRUE(dsp_safeloadParams(params, 5));
+  native_advanceUs(Adau1701Model::kFrameUs);
+  dsp.coreControl();
+  for (int i = 0; i < 5; i++) {
+    TEST_ASSERT_EQUAL_HEX32((uint32_t)params[i].value, dsp.paramWord(params[i].address));
+  }
+}
+
+// Primary group bits are configurable, and a device that drops out mid
+// broadcast is reported while the rest still receive every transfer
+static void test_broadcast_groups_and_partial_failure() {
+  static Adau1701Model second;
+  second.reset();
+  Wire.native_attach(DSP_I2C_ADDRESS + 1, &second);
+  dsp_clearTargets();
+  TEST_ASSERT_TRUE(dsp_addTarget(DSP_I2C_ADDRESS + 1, 0x01));
+  TEST_ASSERT_TRUE(dsp_addTarget(DSP_I2C_ADDRESS, 0x02));
+  TEST_ASSERT_EQUAL(2, dsp_getTargetCount());
+  TEST_ASSERT_EQUAL(0x02, dsp_getTarget(0).groups);
+
+  DSPParamWrite params[12];
+  for (int i = 0; i < 12; i++) {
+    params[i] = { (uint16_t)(200 + i), dsp_floatTo523(0.1f * (i + 1)) };
+  }
+  TEST_ASSERT_TRUE(dsp_broadcastSafeload(0x01, params, 12));
+  native_advanceUs(Adau1701Model::kFrameUs);
+  second.coreControl();
+  TEST_ASSERT_EQUAL(0, dsp.writes);                 // Primary not in group 1
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)params[11].value, second.paramWord(211));
+
+  // Second device stops acknowledging after its first transfer
+  struct Dropout : Adau1701Model {
+    bool ack() override { return safeloads == 0 || (coreControl() & ADAU1701_CORE_CONTROL_IST); }
+  };
+  static Dropout third;
+  third.reset();
+  Wire.native_attach(DSP_I2C_ADDRESS + 1, &third);
+  TEST_ASSERT_FALSE(dsp_broadcastSafeload(0x03, params, 12));
+  native_advanceUs(Adau1701Model::kFrameUs);
+  dsp.coreControl();
+  const DSPBroadcastStats& stats = dsp_getBroadcastStats();
+  TEST_ASSERT_EQUAL(2, stats.lastTargets);
+  TEST_ASSERT_EQUAL(DSP_I2C_ADDRESS, stats.lastResults[0].address);
+  TEST_ASSERT_TRUE(stats.lastResults[0].ok);
+  TEST_ASSERT_EQUAL(3, stats.lastResults[0].transfers);
+  TEST_ASSERT_FALSE(stats.lastResults[1].ok);
+  TEST_ASSERT_EQUAL(1, stats.lastResults[1].transfers);
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)params[11].value, dsp.paramWord(211));
+
+  dsp_clearTargets();
+  TEST_ASSERT_EQUAL(DSP_GROUP_ALL, dsp_getTarget(0).groups);
+}
+
+struct BenchRow {
+  const char* name;
+  uint32_t bytes;
+  NativeWireStats bus;
+};
+
+static void printRow(const BenchRow& r) {
+  printf("  %-34s %6u B %6u xfers %9.1f ms %9.0f B/s\n", r.name, (unsigned)r.bytes,
+         (unsigned)r.bus.transactions, r.bus.busUs / 1000.0,
+         r.bus.busUs ? r.bytes * 1e6 / r.bus.busUs : 0.0);
+}
+
+// Bus time of the ways firmware moves DSP data. "per word" is the best a
+// non-burst driver can do (one addressed transaction per memory word);
+// "per register" is the old byte-at-a-time register read.
+// Without /RESET the DSP cannot reload: self-boot refuses, and the
+// profiler records a core restart that is not a reload
+static void test_boot_without_reset_pin() {
+  TEST_ASSERT_EQUAL(-1, dsp_getResetPin());
+  TEST_ASSERT_FALSE(dsp_canSelfBoot());
+  TEST_ASSERT_FALSE(dsp_selfBoot());
+
+  TEST_ASSERT_TRUE(dsp_profileBoot());
+  const DSPBootProfile& p = dsp_getBootProfile();
+  TEST_ASSERT_TRUE(p.complete);
+  TEST_ASSERT_FALSE(p.hardReset);
+  TEST_ASSERT_FALSE(p.reloaded);
+  TEST_ASSERT_TRUE(dsp.coreControl() & ADAU1701_CORE_CONTROL_CR);
+}
+
+static void test_bus_time_benchmark() {
+  static uint8_t param[ADAU1701_PARAM_RAM_WORDS * ADAU1701_PARAM_WORD_BYTES];
+  static uint8_t prog[ADAU1701_PROG_RAM_WORDS * ADAU1701_PROG_WORD_BYTES];
+  fillPattern(param, sizeof(param), 3);
+  fillPattern(prog, sizeof(prog), 4);
+  const uint32_t clocks[] = { I2C_CLOCK_HZ, I2C_FAST_CLOCK_HZ };
+
+  for (uint32_t hz : clocks) {
+    setUp();
+    useClock(hz);
+    busDelta();
+    printf("\nADAU1701 bus time at %lu Hz\n", (unsigned long)hz);
+
+    for (uint16_t w = 0; w < ADAU1701_PARAM_RAM_WORDS; w++) {
+      dsp_writeBlock(w, param + w * 4, 4);
+    }
+    BenchRow perWord = { "param RAM write, per word", sizeof(param), busDelta() };
+    TEST_ASSERT_TRUE(dsp_writeBlock(0, param, sizeof(param)));
+    BenchRow burst = { "param RAM write, burst", sizeof(param), busDelta() };
+    TEST_ASSERT_EQUAL_MEMORY(param, dsp.param, sizeof(param));
+    printRow(perWord);
+    printRow(burst);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(perWord.bus.busUs * 6 / 10, burst.bus.busUs);
+
+    TEST_ASSERT_TRUE(dsp_writeBlock(ADAU1701_PROG_RAM_START, prog, sizeof(prog)));
+    printRow({ "program RAM write, burst", sizeof(prog), busDelta() });
+    TEST_ASSERT_EQUAL_MEMORY(prog, dsp.program, sizeof(prog));
+
+    static uint8_t back[sizeof(prog)];
+    TEST_ASSERT_TRUE(dsp_readBlock(ADAU1701_PROG_RAM_START, back, sizeof(prog)));
+    printRow({ "program RAM read, burst", sizeof(prog), busDelta() });
+    TEST_ASSERT_EQUAL_MEMORY(prog, back, sizeof(prog));
+
+    dsp_sampleStatus();                           // Detection sweep on first use
+    busDelta();
+    TEST_ASSERT_TRUE(dsp_sampleStatus());
+    BenchRow status = { "status sample (core control)", 2, busDelta() };
+    printRow(status);
+    TEST_ASSERT_EQUAL(2, status.bus.transactions);   // Subaddress write, read
+    TEST_ASSERT_EQUAL_HEX16(dsp.coreControl(), dsp_getStatusSnapshot().status.coreControl);
+
+    DSPParamWrite params[50];
+    for (int i = 0; i < 50; i++) {
+      params[i] = { (uint16_t)(i * 3), dsp_floatTo523(-0.5f + i * 0.02f) };
+    }
+    TEST_ASSERT_TRUE(dsp_safeloadParams(params, 50));
+    printRow({ "safeload, 50 params", 50 * 4, busDelta() });
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_block_round_trip);
+  RUN_TEST(test_burst_alignment);
+  RUN_TEST(test_safeload_applies_every_word);
+  RUN_TEST(test_float_to_523_saturates);
+  RUN_TEST(test_safeload_ignores_stale_staging);
+  RUN_TEST(test_broadcast_groups_and_partial_failure);
+  RUN_TEST(test_boot_without_reset_pin);
+  RUN_TEST(test_bus_time_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,114 @@
+// EEPROM emulator through its Wire1 glue: the native Wire shim plays the
+// ADAU1701 as bus master against the slave callbacks, covering the boot
+// read, random and current-address reads, page writes and the self-test.
+//
+//   pio test -e native -f test_eeprom_emu -v
+#include <Arduino.h>
+#include <unity.h>
+#include "hex_corpus.h"
+#include "selfboot_image.cpp"
+#include "eeprom_emulator.cpp"
+
+static std::vector<uint8_t> g_image;
+
+// Link-time dependencies of eeprom_emulator.cpp and selfboot_image.cpp
+bool readBlockFromEEPROM(uint16_t, uint8_t*, size_t) { return false; }
+bool i2c_busActive(uint8_t) { return false; }
+
+static void masterSetAddress(uint16_t address) {
+  uint8_t a[2] = { (uint8_t)(address >> 8), (uint8_t)address };
+  Wire1.native_masterWrite(a, sizeof(a));
+}
+
+static std::vector<uint8_t> masterRead(size_t length) {
+  std::vector<uint8_t> out(length);
+  Wire1.native_masterRead(out.data(), length);
+  return out;
+}
+
+void setUp() {
+  eeprom_emu_clear();
+  TEST_ASSERT_TRUE(eeprom_emu_stage(g_image.data(), g_image.size(), 0));
+  TEST_ASSERT_TRUE(eeprom_emu_start());
+}
+
+void tearDown() {
+  eeprom_emu_stop();
+}
+
+// The DSP's boot: address 0, then one sequential read of the whole image
+static void test_boot_read_single_transaction() {
+  masterSetAddress(0);
+  std::vector<uint8_t> got = masterRead(g_image.size());
+  TEST_ASSERT_EQUAL_MEMORY(g_image.data(), got.data(), g_image.size());
+
+  selfboot_begin();
+  selfboot_feed(got.data(), got.size());
+  TEST_ASSERT_TRUE(selfboot_getInfo().valid);
+  TEST_ASSERT_EQUAL(1, eeprom_emu_getStats().addressSets);
+  TEST_ASSERT_EQUAL(1, eeprom_emu_getStats().readRequests);
+}
+
+// A new address must drop the bytes an earlier read left queued
+static void test_address_write_flushes_queue() {
+  masterSetAddress(0x0100);
+  std::vector<uint8_t> first = masterRead(16);
+  TEST_ASSERT_EQUAL_MEMORY(&g_image[0x0100], first.data(), 16);
+
+  masterSetAddress(0x0040);
+  std::vector<uint8_t> second = masterRead(8);
+  TEST_ASSERT_EQUAL_MEMORY(&g_image[0x0040], second.data(), 8);
+  TEST_ASSERT_EQUAL_HEX16(0x0040, eeprom_emu_getStats().pointer);
+}
+
+// Without an address write the next read continues where the last stopped
+static void test_current_address_read_continues() {
+  masterSetAddress(0x0200);
+  masterRead(10);
+  std::vector<uint8_t> next = masterRead(6);
+  TEST_ASSERT_EQUAL_MEMORY(&g_image[0x020A], next.data(), 6);
+}
+
+// Page writes wrap inside the page, and the following read sees new data
+static void test_page_write_then_read() {
+  uint16_t at = 0x7FFE - EEPROM_PAGE_SIZE;         // Two bytes before a page end
+  uint8_t write[6] = { (uint8_t)(at >> 8), (uint8_t)at, 0xA1, 0xA2, 0xA3, 0xA4 };
+  masterSetAddress(0);
+  masterRead(4);                                   // Leave stale bytes queued
+  Wire1.native_masterWrite(write, sizeof(write));
+
+  uint16_t page = at - (at % EEPROM_PAGE_SIZE);
+  masterSetAddress(at);
+  std::vector<uint8_t> got = masterRead(2);
+  TEST_ASSERT_EQUAL_HEX8(0xA1, got[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xA2, got[1]);
+  masterSetAddress(page);
+  got = masterRead(2);
+  TEST_ASSERT_EQUAL_HEX8(0xA3, got[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xA4, got[1]);
+  TEST_ASSERT_EQUAL(4, eeprom_emu_getStats().bytesWritten);
+}
+
+// The self-test rewrites the pointer and patches the image, so it must
+// not run under a live master
+static void test_self_test_refused_while_serving() {
+  String report;
+  TEST_ASSERT_FALSE(eeprom_emu_selfTest(report));
+  TEST_ASSERT_TRUE(eeprom_emu_getStats().active);
+
+  eeprom_emu_stop();
+  report = "";
+  TEST_ASSERT_TRUE(eeprom_emu_selfTest(report));
+}
+
+int main(int argc, char** argv) {
+  g_image = corpus_selfBootImage();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_read_single_transaction);
+  RUN_TEST(test_address_write_flushes_queue);
+  RUN_TEST(test_current_address_read_continues);
+  RUN_TEST(test_page_write_then_read);
+  RUN_TEST(test_self_test_refused_while_serving);
+  return UNITY_END();
+}
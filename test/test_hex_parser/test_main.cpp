@@ -0,0 +1,148 @@
+// hex_parser on the host against a stub sink: corpus round trips, a
+// chunk-size benchmark with allocation and memory reports, and randomized
+// chunking / corruption runs.
+//
+//   pio test -e native -f test_hex_parser -v
+#include <Arduino.h>
+#include <unity.h>
+#include "native_heap.h"
+#include "hex_sink.h"
+#include "hex_corpus.h"
+#include "hex_parser.cpp"
+
+static std::vector<uint8_t> g_image;
+static std::vector<CorpusFile> g_files;
+
+void setUp() {
+  stubSink_reset();
+  hex_begin();
+  hex_setDryRun(false);
+  hex_setWriteSink(stubSink_write);
+}
+
+void tearDown() {}
+
+// Feed text the way the upload handler does: fixed chunks, then the
+// empty end-of-stream chunk and a final flush
+static void parseChunked(const std::string& text, size_t chunkSize) {
+  for (size_t pos = 0; pos < text.size(); pos += chunkSize) {
+    size_t n = min(chunkSize, text.size() - pos);
+    unsigned long start = micros();
+    processHexChunk(text.data() + pos, n);
+    hex_accountChunk(n, micros() - start);
+  }
+  processHexChunk("", 0);
+  flushBatch();
+}
+
+static void parseRandomChunks(const std::string& text, uint32_t seed, size_t maxChunk) {
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t n = min<size_t>(1 + corpus_rand(seed) % maxChunk, text.size() - pos);
+    processHexChunk(text.data() + pos, n);
+    pos += n;
+  }
+  processHexChunk("", 0);
+  flushBatch();
+}
+
+static void assertImage(const char* name) {
+  TEST_ASSERT_EQUAL_MESSAGE(0, getChecksumErrors(), name);
+  TEST_ASSERT_EQUAL_MESSAGE(0, stubSink.outOfRange, name);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(g_image.size(), getUploadImageStats().uniqueBytes, name);
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(g_image.data(), stubSink.image, g_image.size(), name);
+}
+
+static void test_corpus_round_trip() {
+  for (const CorpusFile& f : g_files) {
+    setUp();
+    parseChunked(f.text, 1460);
+    assertImage(f.name);
+  }
+}
+
+// Record and token boundaries split at arbitrary points must not change
+// the result
+static void test_random_chunk_boundaries() {
+  uint32_t seed = 0xC0FFEEu;
+  for (const CorpusFile& f : g_files) {
+    for (int run = 0; run < 25; run++) {
+      setUp();
+      parseRandomChunks(f.text, corpus_rand(seed) | 1, run < 10 ? 8 : 700);
+      assertImage(f.name);
+    }
+  }
+}
+
+// Corrupted uploads may fail, but never write outside the EEPROM or crash
+static void test_corrupted_input() {
+  static const char kNoise[] = ":@qS0123456789ABCDEFx,{} \r\n";
+  uint32_t seed = 0x5EED5u;
+  for (int run = 0; run < 400; run++) {
+    const CorpusFile& f = g_files[run % g_files.size()];
+    std::string text = f.text;
+    int edits = 1 + corpus_rand(seed) % 16;
+    for (int e = 0; e < edits; e++) {
+      size_t at = corpus_rand(seed) % text.size();
+      uint32_t r = corpus_rand(seed);
+      if (r % 4 == 0) {
+        text[at] = (char)(r >> 8);
+      } else {
+        text[at] = kNoise[(r >> 8) % (sizeof(kNoise) - 1)];
+      }
+    }
+    if (corpus_rand(seed) % 8 == 0) {
+      text.resize(corpus_rand(seed) % text.size());
+    }
+    setUp();
+    parseRandomChunks(text, corpus_rand(seed) | 1, 600);
+    TEST_ASSERT_EQUAL(0, stubSink.outOfRange);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(EEPROM_SIZE, getUploadImageStats().uniqueBytes);
+  }
+}
+
+// Throughput per format and chunk size. 1460 is a WiFi TCP segment, the
+// size the upload handler usually sees. The streaming path is expected to
+// be allocation-free; its RAM is the parser's static buffers.
+static void test_chunk_size_benchmark() {
+  static const size_t kChunks[] = { 16, 64, 256, 1460, 4096 };
+  const int kRepeats = 20;
+  size_t staticBytes = sizeof(lineBuffer) + sizeof(coverageMap) + sizeof(batchBuffer) +
+                       sizeof(imageStats) + sizeof(perfStats);
+
+  printf("\nhex_parser: %u byte image, %u bytes static parser RAM\n",
+         (unsigned)g_image.size(), (unsigned)staticBytes);
+  printf("%-22s %6s %10s %12s %10s %10s\n", "format", "chunk", "input", "bytes/s", "allocs/KB", "peak heap");
+  for (const CorpusFile& f : g_files) {
+    for (size_t chunk : kChunks) {
+      NativeHeapMark mark = native_heapMark();
+      uint64_t start = native_nowUs();
+      for (int i = 0; i < kRepeats; i++) {
+        setUp();
+        parseChunked(f.text, chunk);
+      }
+      uint64_t us = max<uint64_t>(1, native_nowUs() - start);
+      uint64_t allocs = native_heap.allocations - mark.allocations;
+      uint64_t peak = native_heap.peakBytes - mark.liveBytes;
+      double kb = (double)f.text.size() * kRepeats / 1024.0;
+
+      printf("%-22s %6u %10u %12.0f %10.2f %10u\n", f.name, (unsigned)chunk, (unsigned)f.text.size(),
+             (double)f.text.size() * kRepeats * 1e6 / us, allocs / kb, (unsigned)peak);
+      assertImage(f.name);
+      TEST_ASSERT_EQUAL_UINT64_MESSAGE(0, allocs, f.name);
+      TEST_ASSERT_EQUAL_UINT32(f.text.size(), hex_getPerfStats().inputBytes);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  g_image = corpus_selfBootImage();
+  g_files = corpus_files(g_image);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_corpus_round_trip);
+  RUN_TEST(test_random_chunk_boundaries);
+  RUN_TEST(test_corrupted_input);
+  RUN_TEST(test_chunk_size_benchmark);
+  return UNITY_END();
+}
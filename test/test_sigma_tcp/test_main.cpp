@@ -0,0 +1,100 @@
+// SigmaTCP server against a simulated ADAU1701: recorded SigmaStudio
+// sessions replayed by a stand-in client, checked reply by reply and
+// against the resulting DSP memory, with per-command latency.
+//
+//   pio test -e native -f test_sigma_tcp -v
+#include <Arduino.h>
+#include <unity.h>
+#include "adau1701_model.h"
+#include "eeprom_emulator.h"
+#include "sigma_replay.h"
+#include "session_download_tune.h"
+#include "i2c_bus.cpp"
+#include "dsp_helper.cpp"
+#include "sigma_tcp.cpp"
+
+static Adau1701Model dsp;
+
+// Link-time dependencies of i2c_bus.cpp and dsp_helper.cpp
+const EepromEmuStats& eeprom_emu_getStats() {
+  static EepromEmuStats stats = {};
+  return stats;
+}
+void setWriteProtect(bool) {}
+
+static void resetServer() {
+  tcpClient.stop();
+  tcpState = TCP_STATE_COMMAND;
+  writeStageLen = 0;
+  memset(&tcpStats, 0, sizeof(tcpStats));
+}
+
+void setUp() {
+  dsp.reset();
+  Wire.native_detachAll();
+  Wire.native_attach(DSP_I2C_ADDRESS, &dsp);
+  i2c_busBegin(0, SDA_PIN, SCL_PIN, I2C_FAST_CLOCK_HZ);
+  resetServer();
+  sigma_tcp_begin();
+}
+
+void tearDown() {}
+
+static void assertReplay(const SigmaReplayResult& r) {
+  if (!r.ok) {
+    printf("replay failed at transcript line %d: %s\n", r.line, r.message.c_str());
+  }
+  TEST_ASSERT_TRUE(r.ok);
+}
+
+static void test_replay_download_and_tuning() {
+  uint64_t busStart = Wire.stats.busUs;
+  SigmaReplayResult r = sigma_replay(tcpServer, kSessionDownloadTune, sigma_tcp_service);
+  assertReplay(r);
+
+  const SigmaTcpStats& stats = sigma_tcp_getStats();
+  TEST_ASSERT_EQUAL(2, r.connections);
+  TEST_ASSERT_EQUAL(r.connections, stats.connections);
+  TEST_ASSERT_EQUAL(kSessionDownloadTuneErrors, stats.errors);
+  TEST_ASSERT_EQUAL(0, dsp.coreControl() & ADAU1701_CORE_CONTROL_IST);
+  TEST_ASSERT_EQUAL_HEX32(0x001C, dsp.coreControl());
+  TEST_ASSERT_EQUAL(5, dsp.safeloads);            // 1 + 3 single moves, 1 biquad
+
+  printf("\nSigmaTCP replay: %u segments, %u bytes in, %u bytes out\n", (unsigned)r.segments,
+         (unsigned)r.bytesSent, (unsigned)r.bytesReceived);
+  printf("  %u writes, %u reads, %.1f ms on the DSP bus, max command %.2f ms\n",
+         (unsigned)stats.writes, (unsigned)stats.reads, (Wire.stats.busUs - busStart) / 1000.0,
+         stats.maxCommandUs / 1000.0);
+}
+
+// Slider moves arrive one by one: each must finish within a frame of
+// interactive latency, bus time included
+static void test_safeload_latency() {
+  static const char kMoves[] =
+      "! connect\n"
+      "> 09 01 00 00 0E 68 00 04 00 10 00 40 00 00\n"
+      "> 09 01 00 00 0E 68 00 04 00 11 00 20 00 00\n"
+      "> 0A 00 08 68 00 08 00 10\n"
+      "< 0B 00 0C 00 00 40 00 00 00 20 00 00\n";
+  assertReplay(sigma_replay(tcpServer, kMoves, sigma_tcp_service));
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(5000, sigma_tcp_getStats().maxCommandUs);
+}
+
+// The replay client itself reports a wrong reply with its line
+static void test_replay_detects_mismatch() {
+  static const char kWrong[] =
+      "! connect\n"
+      "> 0A 00 08 68 00 02 08 1C\n"
+      "< 0B 00 06 00 00 01\n";
+  SigmaReplayResult r = sigma_replay(tcpServer, kWrong, sigma_tcp_service);
+  TEST_ASSERT_FALSE(r.ok);
+  TEST_ASSERT_EQUAL(3, r.line);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_download_and_tuning);
+  RUN_TEST(test_safeload_latency);
+  RUN_TEST(test_replay_detects_mismatch);
+  return UNITY_END();
+}